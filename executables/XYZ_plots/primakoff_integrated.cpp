@@ -17,8 +17,7 @@
 
 #include "constants.hpp"
 #include "reaction_kinematics.hpp"
-#include "amplitudes/primakoff_effect.hpp"
-#include "amplitudes/amplitude_sum.hpp"
+#include "amplitudes/primakoff_batch.hpp"
 
 #include "jpacGraph1D.hpp"
 #include "jpacUtils.hpp"
@@ -36,45 +35,13 @@ int main( int argc, char** argv )
     double Q2 = 0.5;
     double mX = 3.872;
 
-    // Uranium
-    double mU = 221.6977;
-    reaction_kinematics * kU = new reaction_kinematics(mX, mU, mU);
-    kU->set_Q2(Q2);
-    kU->set_JP(1, 1);
-
-    primakoff_effect U(kU, "^{238}U");
-    U.set_params({92, 34.48, 3.07, 3.2E-3});
-
-    // Tin
-    double mSn = 115.3924;
-    reaction_kinematics * kSn = new reaction_kinematics(mX, mSn, mSn);
-    kSn->set_Q2(Q2);
-    kSn->set_JP(1, 1);
-
-    primakoff_effect Sn(kSn, "^{124}Sn");
-    Sn.set_params({50, 27.56, 2.73, 3.2E-3});
-
-    // Zinc
-    double mZn = 65.1202;
-    reaction_kinematics * kZn = new reaction_kinematics(mX, mZn, mZn);
-    kZn->set_Q2(Q2);
-    kZn->set_JP(1, 1);
-
-    primakoff_effect Zn(kZn, "^{70}Zn");
-    Zn.set_params({30, 22.34, 2.954, 3.2E-3});
+    // One primakoff_effect for each nucleus with the same X -> gamma gamma* coupling
+    primakoff_batch amps(mX, {"Zn70", "Sn124", "U238"}, Q2, 3.2E-3);
 
     // ---------------------------------------------------------------------------
     // Plotting options
     // ---------------------------------------------------------------------------
 
-    // which amps to plot
-    std::vector<primakoff_effect*> amps;
-    amps.push_back(&Zn);
-    amps.push_back(&Sn);
-    amps.push_back(&U);
-
-    double xNs[3] = {70., 124., 238.}; // number of nucleons 
-
     int N = 50;
     std::string filename = "primakoff_integrated.pdf";
 
@@ -96,27 +63,44 @@ int main( int argc, char** argv )
     jpacGraph1D* plotter = new jpacGraph1D();
 
     // ---------------------------------------------------------------------------
-    // Print the desired observable for each amplitude
-    for (int n = 0; n < amps.size(); n++)
-    {     
-        double xmin = (amps[n]->_kinematics->Wth() + EPS) / xNs[n];
+    // Print the desired observable for each amplitude, all nuclei evaluated together
+    // Energies are per nucleon, from each nucleus' threshold to xmax
+    std::vector<double> xmin(amps.size()), u(N);
+    for (int n = 0; n < amps.size(); n++) xmin[n] = (amps.amplitude(n)->_kinematics->Wth() + EPS) / amps.target(n)._A;
+    for (int i = 0; i < N; i++) u[i] = double(i) / double(N - 1);
 
-        auto F = [&](double x)
-        {
-            x *= xNs[n];
-            return amps[n]->integrated_xsection(x*x);
-        };
+    auto x = [&](int n, double u)
+    {
+        return xmin[n] + u * (xmax - xmin[n]);
+    };
+
+    auto F = [&](int n, double u)
+    {
+        double W = x(n, u) * amps.target(n)._A;
+        return amps.amplitude(n)->integrated_xsection(W*W);
+    };
 
-        std::array<std::vector<double>, 2> x_fx, x_fx2; 
+    amps.set_LT(0);
+    std::vector<std::vector<double>> sigmaL = amps.evaluate(F, u);
 
-        std::cout << std::endl << "Printing longitudinal xsection: " << amps[n]->_identifier << "\n";
-        x_fx = vec_fill(N, F, xmin, xmax, print_to_cmd);
-        plotter->AddEntry(x_fx[0], x_fx[1], amps[n]->_identifier);
+    amps.set_LT(1);
+    std::vector<std::vector<double>> sigmaT = amps.evaluate(F, u);
+
+    for (int n = 0; n < amps.size(); n++)
+    {
+        std::string id = amps.amplitude(n)->_identifier;
+
+        std::vector<double> xs(N);
+        for (int i = 0; i < N; i++) xs[i] = x(n, u[i]);
+
+        if (print_to_cmd == true)
+        {
+            std::cout << std::endl << "Printing longitudinal and transverse xsection: " << id << "\n";
+            for (int i = 0; i < N; i++) debug(xs[i], sigmaL[n][i], sigmaT[n][i]);
+        }
 
-        amps[n]->set_LT(1);
-        std::cout << std::endl << "Printing transverse xsection: " << amps[n]->_identifier << "\n";
-        x_fx2 = vec_fill  (N, F, xmin, xmax, print_to_cmd);
-        plotter->AddDashedEntry(x_fx2[0], x_fx2[1]);
+        plotter->AddEntry(xs, sigmaL[n], id);
+        plotter->AddDashedEntry(xs, sigmaT[n]);
     }
 
       // Add a header to legend to specify the fixed Q2
@@ -126,7 +110,7 @@ int main( int argc, char** argv )
     plotter->SetLegend(0.2, 0.74, header);
 
     // Set up axes
-    plotter->SetXaxis(xlabel, kZn->Wth() / xNs[0], xmax);
+    plotter->SetXaxis(xlabel, xmin[0], xmax);
     plotter->SetYaxis(ylabel, ymin, ymax);
     plotter->SetYlogscale(true);
 
@@ -135,7 +119,6 @@ int main( int argc, char** argv )
 
     // Cleanup
     delete plotter;
-    delete kU, kSn, kZn;
 
     return 1.;
 };
\ No newline at end of file
@@ -0,0 +1,161 @@
+// ---------------------------------------------------------------------------
+// Compare the helicity amplitudes of every amplitude in the library between builds
+// using the Dirac and chiral (Weyl) representations of the gamma matrices and spinors.
+// Amplitudes are physical observables and must not depend on the basis, up to rounding.
+//
+// USAGE:
+// cmake -DCHIRAL_BASIS=OFF .. && make basis_check && ./basis_check -o dirac.txt
+// cmake -DCHIRAL_BASIS=ON  .. && make basis_check && ./basis_check -c dirac.txt
+//
+// -o file : write all amplitudes to file
+// -c file : compare all amplitudes with those previously written to file
+// -t tol  : maximum deviation relative to the largest amplitude at each point (default 1.E-11)
+//
+// OUTPUT:
+// Amplitudes to file (-o) or largest deviation for each amplitude (-c)
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    std::string output = "", reference = "";
+    double tolerance = 1.E-11;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (std::strcmp(argv[i],"-o")==0) output = argv[i+1];
+        if (std::strcmp(argv[i],"-c")==0) reference = argv[i+1];
+        if (std::strcmp(argv[i],"-t")==0) tolerance = atof(argv[i+1]);
+    }
+
+    if (output == "" && reference == "")
+    {
+        std::cout << "basis_check: pass either -o file to write or -c file to compare amplitudes.\n";
+        exit(0);
+    }
+
+    #ifdef JPAC_CHIRAL_BASIS
+    std::cout << "Evaluating amplitudes in the chiral basis.\n";
+    #else
+    std::cout << "Evaluating amplitudes in the Dirac basis.\n";
+    #endif
+
+    // Every helicity amplitude of every amplitude at each kinematic point
+    // saved by "name W theta"
+    std::map<std::string, std::vector<std::complex<double>>> amplitudes;
+
+    test_amplitudes amps;
+    for (int n = 0; n < amps.size(); n++)
+    {
+        amplitude * amp = amps[n].amp;
+        for (int i = 0; i < TEST_W.size(); i++)
+        {
+            if (TEST_W[i] < amp->_kinematics->Wth() + 0.01) continue;
+            double s = TEST_W[i] * TEST_W[i];
+
+            for (int j = 0; j < TEST_THETA.size(); j++)
+            {
+                double t = amp->_kinematics->t_man(s, TEST_THETA[j]);
+
+                std::vector<std::complex<double>> result;
+                for (int k = 0; k < amp->_kinematics->_nAmps; k++)
+                {
+                    result.push_back(amp->helicity_amplitude(amp->_kinematics->_helicities[k], s, t));
+                }
+
+                std::stringstream key;
+                key << amps[n].name << " " << TEST_W[i] << " " << TEST_THETA[j];
+                amplitudes[key.str()] = result;
+            }
+        }
+    }
+
+    // Write everything out
+    if (output != "")
+    {
+        std::ofstream out(output);
+        out << std::scientific << std::setprecision(17);
+
+        std::map<std::string, std::vector<std::complex<double>>>::iterator entry;
+        for (entry = amplitudes.begin(); entry != amplitudes.end(); entry++)
+        {
+            out << entry->first;
+            for (int k = 0; k < entry->second.size(); k++)
+            {
+                out << " " << real(entry->second[k]) << " " << imag(entry->second[k]);
+            }
+            out << "\n";
+        }
+
+        std::cout << "Amplitudes written to " << output << ".\n";
+        return 0;
+    }
+
+    // or compare with the reference file
+    std::ifstream in(reference);
+    if (!in.is_open())
+    {
+        std::cout << "basis_check: Cannot open " << reference << "!\n";
+        exit(0);
+    }
+
+    std::map<std::string, comparison> comparisons;
+    int found = 0;
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::stringstream fields(line);
+        std::string name, W, theta;
+        fields >> name >> W >> theta;
+
+        std::map<std::string, std::vector<std::complex<double>>>::iterator entry;
+        entry = amplitudes.find(name + " " + W + " " + theta);
+        if (entry == amplitudes.end()) continue;
+        found++;
+
+        std::vector<std::complex<double>> saved;
+        double re, im;
+        while (fields >> re >> im) saved.push_back(std::complex<double>(re, im));
+
+        if (comparisons.find(name) == comparisons.end())
+        {
+            comparisons.insert(std::make_pair(name, comparison(name, tolerance)));
+        }
+        comparison & c = comparisons.find(name)->second;
+
+        // Mismatched number of helicities counts as a failure
+        if (saved.size() != entry->second.size())
+        {
+            c.add(1., 0.);
+            continue;
+        }
+
+        double scale = std::max(max_modulus(saved), max_modulus(entry->second));
+        for (int k = 0; k < saved.size(); k++) c.add(saved[k], entry->second[k], scale);
+    }
+
+    if (found != amplitudes.size())
+    {
+        std::cout << "basis_check: Only " << found << " of " << amplitudes.size() << " points found in " << reference << "!\n";
+        return 1;
+    }
+
+    bool pass = true;
+    std::map<std::string, comparison>::iterator c;
+    for (c = comparisons.begin(); c != comparisons.end(); c++) pass &= c->second.report();
+
+    return (pass) ? 0 : 1;
+};
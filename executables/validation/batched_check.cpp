@@ -0,0 +1,97 @@
+// ---------------------------------------------------------------------------
+// Compare amplitudes which evaluate all helicities at once, at a single point
+// and on a grid of t, against single helicity evaluations of an independent copy
+// of the same amplitude, together with the batched differential cross-section.
+//
+// USAGE:
+// make batched_check && ./batched_check
+//
+// OUTPUT:
+// Largest deviation for each amplitude, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+// Amplitudes which override helicity_amplitudes()
+const std::vector<std::string> BATCHED = {"pseudoscalar", "pomeron", "dirac", "rarita"};
+
+bool compare_batched(std::string name, amplitude * batched, amplitude * single)
+{
+    reaction_kinematics * kinem = batched->_kinematics;
+
+    comparison point(name + ", all helicities at one point", 1.E-14);
+    comparison grid(name + ", all helicities on a t grid", 1.E-14);
+    comparison xsection(name + ", dsigma/dt on a t grid", 1.E-14);
+
+    for (int i = 0; i < TEST_W.size(); i++)
+    {
+        if (TEST_W[i] < kinem->Wth() + 0.01) continue;
+        double s = TEST_W[i] * TEST_W[i];
+
+        std::vector<double> t;
+        for (int j = 0; j < TEST_THETA.size(); j++) t.push_back(kinem->t_man(s, TEST_THETA[j]));
+
+        std::vector<std::vector<std::complex<double>>> on_grid;
+        batched->helicity_amplitudes(s, t, on_grid);
+        std::vector<double> dsigma = batched->differential_xsection(s, t);
+
+        for (int j = 0; j < t.size(); j++)
+        {
+            std::vector<std::complex<double>> at_point, reference;
+            batched->helicity_amplitudes(s, t[j], at_point);
+            for (int k = 0; k < kinem->_nAmps; k++)
+            {
+                reference.push_back(single->helicity_amplitude(kinem->_helicities[k], s, t[j]));
+            }
+
+            double scale = max_modulus(reference);
+            for (int k = 0; k < reference.size(); k++)
+            {
+                point.add(at_point[k], reference[k], scale);
+                grid.add(on_grid[j][k], reference[k], scale);
+            }
+
+            xsection.add(dsigma[j], single->differential_xsection(s, t[j]));
+        }
+    }
+
+    bool pass = true;
+    pass &= point.report();
+    pass &= grid.report();
+    pass &= xsection.report();
+    return pass;
+};
+
+int main( int argc, char** argv )
+{
+    test_amplitudes batched;
+    test_amplitudes single;
+
+    bool pass = true;
+    for (int n = 0; n < batched.size(); n++)
+    {
+        for (int i = 0; i < BATCHED.size(); i++)
+        {
+            if (batched[n].name.find(BATCHED[i]) != 0) continue;
+            pass &= compare_batched(batched[n].name, batched[n].amp, single[n].amp);
+        }
+    }
+
+    // Pomeron exchange also with the explicit contraction of its currents
+    for (int n = 0; n < batched.size(); n++)
+    {
+        if (batched[n].name.find("pomeron") != 0) continue;
+
+        static_cast<pomeron_exchange*>(batched[n].amp)->force_covariant(true);
+        static_cast<pomeron_exchange*>(single[n].amp)->force_covariant(true);
+        pass &= compare_batched(batched[n].name + "_covariant", batched[n].amp, single[n].amp);
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,148 @@
+// ---------------------------------------------------------------------------
+// Compare the nucleon currents from spinor_bilinear with the same bilinears
+// summed explicitly over the components of dirac_spinor, for both the
+// numeric and closed-form evaluation modes.
+//
+// USAGE:
+// make bilinear_check && ./bilinear_check
+//
+// OUTPUT:
+// Largest relative deviation for each current
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "spinor_bilinear.hpp"
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    // Elastic and inelastic baryon vertices
+    std::vector<reaction_kinematics*> kinematics;
+    kinematics.push_back(new reaction_kinematics(M_JPSI));
+    kinematics.push_back(new reaction_kinematics(M_D, M_LAMBDAC, M_PROTON));
+
+    // Arbitrary complex four-vector for the slashed and tensor currents
+    lorentz_vector a(std::complex<double>(0.7, 0.2), std::complex<double>(-0.3, 1.1),
+                     std::complex<double>(0.4, -0.5), std::complex<double>(1.3, 0.6));
+
+    bool pass = true;
+    for (int mode = 0; mode <= 1; mode++)
+    {
+        std::string label = (mode == 0) ? " (numeric)" : " (closed-form)";
+        comparison vector("vector current" + label, 1.E-13);
+        comparison scalar("scalar current" + label, 1.E-13);
+        comparison pseudo("pseudoscalar current" + label, 1.E-13);
+        comparison slashed("slashed current" + label, 1.E-13);
+        comparison tensor("tensor current" + label, 1.E-13);
+        comparison transfer("momentum-transfer tensor current" + label, 1.E-13);
+        comparison matrix("generic contraction, rows and columns" + label, 1.E-13);
+
+        for (int n = 0; n < kinematics.size(); n++)
+        {
+            reaction_kinematics * kinem = kinematics[n];
+            spinor_bilinear * bilinears = kinem->_bilinears;
+            bilinears->set_mode(mode);
+
+            for (int i = 0; i < TEST_W.size(); i++)
+            {
+                if (TEST_W[i] < kinem->Wth() + 0.01) continue;
+                double s = TEST_W[i] * TEST_W[i];
+
+                for (int j = 0; j < TEST_THETA.size(); j++)
+                {
+                    double theta = TEST_THETA[j];
+                    bilinears->update(s, theta);
+
+                    // Momentum transfer between the nucleons
+                    // two_body_state::p() already points the baryon opposite to the meson
+                    lorentz_vector q = kinem->_final_state->p(s, theta) - kinem->_initial_state->p(s, 0.);
+
+                    for (int lam_targ = -1; lam_targ <= 1; lam_targ += 2)
+                    {
+                        for (int lam_rec = -1; lam_rec <= 1; lam_rec += 2)
+                        {
+                            // Explicit components, target at theta = pi and recoil at theta + pi
+                            std::complex<double> u[4], ubar[4];
+                            for (int k = 0; k < 4; k++)
+                            {
+                                u[k]    = kinem->_target->component(k, lam_targ, s, PI);
+                                ubar[k] = kinem->_recoil->adjoint_component(k, lam_rec, s, theta + PI);
+                            }
+
+                            std::complex<double> S = 0., P = 0., V[4] = {0., 0., 0., 0.}, T[4] = {0., 0., 0., 0.}, Tq[4] = {0., 0., 0., 0.};
+                            for (int k = 0; k < 4; k++)
+                            {
+                                for (int l = 0; l < 4; l++)
+                                {
+                                    if (k == l) S += ubar[k] * u[l];
+                                    P += ubar[k] * GAMMA_5[k][l] * u[l];
+
+                                    for (int mu = 0; mu < 4; mu++)
+                                    {
+                                        V[mu] += ubar[k] * GAMMA[mu][k][l] * u[l];
+                                        for (int nu = 0; nu < 4; nu++)
+                                        {
+                                            T[mu]  += ubar[k] * sigma(mu, nu, k, l) * u[l] * METRIC[nu] * a[nu];
+                                            Tq[mu] += ubar[k] * sigma(mu, nu, k, l) * u[l] * METRIC[nu] * q[nu];
+                                        }
+                                    }
+                                }
+                            }
+
+                            std::complex<double> aslash = 0.;
+                            for (int mu = 0; mu < 4; mu++) aslash += METRIC[mu] * a[mu] * V[mu];
+
+                            // Overall size of the currents to compare against
+                            double scale = std::abs(S) + std::abs(P);
+                            for (int mu = 0; mu < 4; mu++) scale += std::abs(V[mu]);
+
+                            scalar.add(bilinears->scalar_current(lam_targ, lam_rec), S, scale);
+                            pseudo.add(bilinears->pseudoscalar_current(lam_targ, lam_rec), P, scale);
+                            slashed.add(bilinears->slashed_current(a, lam_targ, lam_rec), aslash, scale);
+
+                            lorentz_vector vec = bilinears->vector_current(lam_targ, lam_rec);
+                            lorentz_vector ten = bilinears->tensor_current(a, lam_targ, lam_rec);
+                            lorentz_vector tenq = bilinears->tensor_current(lam_targ, lam_rec);
+                            for (int mu = 0; mu < 4; mu++)
+                            {
+                                vector.add(vec[mu], V[mu], scale);
+                                tensor.add(ten[mu], T[mu], scale);
+                                transfer.add(tenq[mu], Tq[mu], scale);
+                            }
+
+                            // gamma^2 as a generic matrix through contract(), row() and column()
+                            std::complex<double> row[4], column[4];
+                            bilinears->row(GAMMA[2], lam_rec, row);
+                            bilinears->column(GAMMA[2], lam_targ, column);
+
+                            std::complex<double> from_row = 0., from_column = 0.;
+                            for (int k = 0; k < 4; k++)
+                            {
+                                from_row    += row[k] * u[k];
+                                from_column += ubar[k] * column[k];
+                            }
+                            matrix.add(bilinears->contract(GAMMA[2], lam_targ, lam_rec), V[2], scale);
+                            matrix.add(from_row, V[2], scale);
+                            matrix.add(from_column, V[2], scale);
+                        }
+                    }
+                }
+            }
+        }
+
+        pass &= vector.report();
+        pass &= scalar.report();
+        pass &= pseudo.report();
+        pass &= slashed.report();
+        pass &= tensor.report();
+        pass &= transfer.report();
+        pass &= matrix.report();
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,63 @@
+// ---------------------------------------------------------------------------
+// Compare the helicity amplitudes of every amplitude in the library evaluated with the
+// closed-form nucleon currents of spinor_bilinear against the numeric 4x4 contractions.
+//
+// USAGE:
+// make closed_form_check && ./closed_form_check
+//
+// OUTPUT:
+// Largest deviation for each amplitude, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    // Two independent copies of every amplitude, each with their own kinematics
+    test_amplitudes numeric;
+    test_amplitudes analytic;
+
+    for (int n = 0; n < numeric.size(); n++)
+    {
+        numeric[n].amp->_kinematics->_bilinears->set_mode(0);
+        analytic[n].amp->_kinematics->_bilinears->set_mode(1);
+    }
+
+    bool pass = true;
+    for (int n = 0; n < numeric.size(); n++)
+    {
+        amplitude * a = numeric[n].amp, * b = analytic[n].amp;
+        comparison c(numeric[n].name, 1.E-12);
+
+        for (int i = 0; i < TEST_W.size(); i++)
+        {
+            if (TEST_W[i] < a->_kinematics->Wth() + 0.01) continue;
+            double s = TEST_W[i] * TEST_W[i];
+
+            for (int j = 0; j < TEST_THETA.size(); j++)
+            {
+                double t = a->_kinematics->t_man(s, TEST_THETA[j]);
+
+                std::vector<std::complex<double>> x, y;
+                for (int k = 0; k < a->_kinematics->_nAmps; k++)
+                {
+                    x.push_back(a->helicity_amplitude(a->_kinematics->_helicities[k], s, t));
+                    y.push_back(b->helicity_amplitude(b->_kinematics->_helicities[k], s, t));
+                }
+
+                double scale = std::max(max_modulus(x), max_modulus(y));
+                for (int k = 0; k < x.size(); k++) c.add(x[k], y[k], scale);
+            }
+        }
+
+        pass &= c.report();
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,75 @@
+// ---------------------------------------------------------------------------
+// Compare the tabulated factorials, binomial coefficients, and leading Wigner coefficients
+// with the same quantities from std::tgamma and std::lgamma,
+// both inside the tables and past them where they are evaluated directly.
+//
+// USAGE:
+// make coefficient_check && ./coefficient_check
+//
+// OUTPUT:
+// Largest relative deviation for each table
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "misc_math.hpp"
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    comparison factorials("factorial(n) vs tgamma(n + 1), n <= 170", 1.E-13);
+    comparison binomials("binomial(n, k) vs lgamma, n <= 60", 1.E-12);
+    comparison leading("wigner_leading_coeff vs tgamma, j <= 14", 1.E-13);
+    comparison bounds("out of range arguments", 0.);
+
+    for (int n = 0; n <= FACTORIAL_MAX; n++)
+    {
+        factorials.add(factorial(n), std::tgamma(n + 1.));
+    }
+
+    for (int n = 0; n <= BINOMIAL_MAX + 20; n++)
+    {
+        for (int k = 0; k <= n; k++)
+        {
+            double reference = exp(std::lgamma(n + 1.) - std::lgamma(k + 1.) - std::lgamma(n - k + 1.));
+            binomials.add(binomial(n, k), std::round(reference));
+        }
+    }
+
+    for (int j = 0; j <= WIGNER_JMAX + 4; j++)
+    {
+        for (int lam1 = -j; lam1 <= j; lam1++)
+        {
+            for (int lam2 = -j; lam2 <= j; lam2++)
+            {
+                int M = std::max(std::abs(lam1), std::abs(lam2));
+                int N = std::min(std::abs(lam1), std::abs(lam2));
+                int lambda = std::abs(lam1 - lam2) + lam1 - lam2;
+
+                double reference = std::tgamma(2. * j + 1.);
+                reference /= sqrt(std::tgamma(j - M + 1.) * std::tgamma(j + M + 1.) * std::tgamma(j - N + 1.) * std::tgamma(j + N + 1.));
+                reference /= pow(2., j - M);
+                if ((lambda / 2) % 2 != 0) reference *= -1.;
+
+                leading.add(wigner_leading_coeff(j, lam1, lam2), reference);
+            }
+        }
+    }
+
+    bounds.add(factorial(-1), 0.);
+    bounds.add(std::isinf(factorial(FACTORIAL_MAX + 1)) ? 0. : 1., 0.);
+    bounds.add(binomial(5, 6), 0.);
+    bounds.add(binomial(5, -1), 0.);
+
+    bool pass = true;
+    pass &= factorials.report();
+    pass &= binomials.report();
+    pass &= leading.report();
+    pass &= bounds.report();
+
+    return (pass) ? 0 : 1;
+};
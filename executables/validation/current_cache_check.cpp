@@ -0,0 +1,89 @@
+// ---------------------------------------------------------------------------
+// Compare covariant vector exchange amplitudes, which save their vertex currents
+// for all helicities at each kinematic point, with newly constructed amplitudes at every point,
+// also after changing the produced mass, the photon virtuality and the couplings.
+//
+// USAGE:
+// make current_cache_check && ./current_cache_check
+//
+// OUTPUT:
+// Largest deviation for each amplitude and change, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+// Fixed-spin exchange evaluated with Feynman rules for given quantum numbers
+struct covariant_exchange
+{
+    std::string name;
+    reaction_kinematics * kinematics;
+    double mass;
+    std::vector<double> couplings;
+    int form_factor;
+    double cutoff;
+
+    vector_exchange * make()
+    {
+        vector_exchange * x = new vector_exchange(kinematics, mass, name);
+        x->set_params(couplings);
+        x->set_formfactor(form_factor, cutoff);
+        x->force_covariant(true);
+        return x;
+    };
+};
+
+int main( int argc, char** argv )
+{
+    reaction_kinematics * kX = new reaction_kinematics(M_X3872);
+    kX->set_JP(1, 1);
+
+    reaction_kinematics * kD = new reaction_kinematics(M_D, M_LAMBDAC, M_PROTON);
+    kD->set_JP(0, -1);
+
+    reaction_kinematics * kDstar = new reaction_kinematics(M_DSTAR, M_LAMBDAC, M_PROTON);
+    kDstar->set_JP(1, -1);
+
+    reaction_kinematics * kS = new reaction_kinematics(M_CHIC1 - 0.1);
+    kS->set_JP(0, 1);
+
+    // Every allowed J^P
+    std::vector<covariant_exchange> exchanges;
+    exchanges.push_back({"A-V-V", kX, M_RHO, {3.6E-3, 2.4, 14.6}, 1, 1.4});
+    exchanges.push_back({"P-V-V", kD, M_DSTAR, {0.134, -13.2, 0.5}, 2, M_DSTAR + 0.25});
+    exchanges.push_back({"V-V-V", kDstar, M_DSTAR, {0.641, -13.2, 0.3}, 0, 0.});
+    exchanges.push_back({"S-V-V", kS, M_OMEGA, {0.1, 2., 1.}, 0, 0.});
+
+    std::vector<vector_exchange*> amps;
+    for (int i = 0; i < exchanges.size(); i++) amps.push_back(exchanges[i].make());
+
+    bool pass = true;
+    std::vector<std::string> changes = {"", "mX", "Q2", "couplings"};
+    for (int n = 0; n < changes.size(); n++)
+    {
+        for (int i = 0; i < exchanges.size(); i++)
+        {
+            reaction_kinematics * kinem = exchanges[i].kinematics;
+
+            if (changes[n] == "mX") kinem->set_mX(kinem->_mX + 0.1);
+            if (changes[n] == "Q2") kinem->set_Q2(0.5);
+            if (changes[n] == "couplings")
+            {
+                exchanges[i].couplings[0] *= 2.;
+                amps[i]->set_params(exchanges[i].couplings);
+            }
+
+            std::string label = exchanges[i].name + ((changes[n] == "") ? "" : " after changing " + changes[n]);
+            comparison c(label, 0.);
+            compare_with_new(amps[i], [&](){ return exchanges[i].make(); }, c);
+            pass &= c.report();
+        }
+    }
+
+    return (pass) ? 0 : 1;
+};
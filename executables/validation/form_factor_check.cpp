@@ -0,0 +1,106 @@
+// ---------------------------------------------------------------------------
+// Compare Primakoff differential cross-sections off U, Sn and Zn with the nuclear form factor
+// interpolated from its table against those with the fourier transform calculated at every point,
+// and the closed forms of the normalization and form factor against numerical integration,
+// for longitudinal and transverse photons.
+//
+// USAGE:
+// make form_factor_check && ./form_factor_check
+//
+// OUTPUT:
+// Largest deviation for each nucleus relative to the peak of the cross-section
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "amplitudes/primakoff_effect.hpp"
+
+using namespace jpacPhoto;
+
+// Fermi distribution parameters of each nucleus
+struct nucleus
+{
+    std::string name;
+    int A;
+    double mass;
+    std::vector<double> params; // Z, radius, skin thickness, photon coupling
+};
+
+const std::vector<nucleus> NUCLEI =
+{
+    {"U238",  238, 221.6977, {92, 34.48, 3.07,  3.2E-3}},
+    {"Sn124", 124, 115.3924, {50, 27.56, 2.73,  3.2E-3}},
+    {"Zn70",   70,  65.1202, {30, 22.34, 2.954, 3.2E-3}}
+};
+
+// Compare dsigma/dt through the forward peak and out to where the form factor has fallen by many orders of magnitude,
+// at a few energies per nucleon. Deviations are relative to the largest cross-section at each energy
+void compare_xsection(int A, primakoff_effect * a, primakoff_effect * b, comparison & c)
+{
+    reaction_kinematics * kinem = a->_kinematics;
+    for (double W = 1.5; W <= 5.; W += 1.75)
+    {
+        double s = pow(A * W, 2.);
+
+        std::vector<double> x, y;
+        for (double theta = 1.E-7; theta < 0.05; theta *= 1.2)
+        {
+            double t = kinem->t_man(s, theta);
+            x.push_back(a->differential_xsection(s, t));
+            y.push_back(b->differential_xsection(s, t));
+        }
+
+        double scale = 0.;
+        for (int i = 0; i < x.size(); i++) scale = std::max(scale, std::max(std::abs(x[i]), std::abs(y[i])));
+        for (int i = 0; i < x.size(); i++) c.add(x[i], y[i], scale);
+    }
+};
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+    for (int n = 0; n < NUCLEI.size(); n++)
+    {
+        reaction_kinematics * kinem = new reaction_kinematics(M_X3872, NUCLEI[n].mass, NUCLEI[n].mass);
+        kinem->set_JP(1, 1);
+        kinem->set_Q2(0.5);
+
+        for (int LT = 0; LT <= 1; LT++)
+        {
+            std::string photon = (LT == 0) ? ", longitudinal" : ", transverse";
+
+            // The table is only used with the numerical fourier transform
+            primakoff_effect * tabulated = new primakoff_effect(kinem);
+            primakoff_effect * direct    = new primakoff_effect(kinem);
+            tabulated->set_params(NUCLEI[n].params);
+            direct->set_params(NUCLEI[n].params);
+            tabulated->set_LT(LT);
+            direct->set_LT(LT);
+            tabulated->force_numerical(true);
+            direct->force_numerical(true);
+            direct->set_form_factor_tolerance(0.);
+
+            comparison table(NUCLEI[n].name + photon + ", tabulated vs direct", 1.E-6);
+            compare_xsection(NUCLEI[n].A, tabulated, direct, table);
+            pass &= table.report();
+
+            // Closed forms by default
+            primakoff_effect * closed = new primakoff_effect(kinem);
+            closed->set_params(NUCLEI[n].params);
+            closed->set_LT(LT);
+
+            comparison numerical(NUCLEI[n].name + photon + ", closed form vs numerical", 1.E-7);
+            compare_xsection(NUCLEI[n].A, closed, direct, numerical);
+            pass &= numerical.report();
+
+            delete tabulated;
+            delete direct;
+            delete closed;
+        }
+    }
+
+    return (pass) ? 0 : 1;
+};
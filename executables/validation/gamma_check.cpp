@@ -0,0 +1,91 @@
+// ---------------------------------------------------------------------------
+// Compare the Lanczos complex Gamma function with cgamma on a grid in the complex plane
+// and with std::tgamma / std::lgamma on the real axis, and time both implementations.
+//
+// USAGE:
+// make gamma_check && ./gamma_check
+//
+// OUTPUT:
+// Largest relative deviation for each check and evaluation times
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "misc_math.hpp"
+
+#include <chrono>
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    // -10 < Re z < 30 and |Im z| < 8 avoiding the poles on the real axis
+    std::vector<std::complex<double>> z;
+    for (double x = -9.7; x < 30.; x += 0.173)
+    {
+        for (double y = -8.; y <= 8.; y += 0.61) z.push_back(std::complex<double>(x, y));
+    }
+
+    std::vector<double> x;
+    for (double xi = -9.95; xi < 30.; xi += 0.1) x.push_back(xi);
+
+    comparison complex_gamma("lanczos_gamma vs cgamma", 1.E-13);
+    comparison log_gamma("exp(log Gamma), lanczos_gamma vs cgamma", 1.E-13);
+    comparison real_gamma("lanczos_gamma vs std::tgamma, real z", 1.E-13);
+    comparison real_log("log Gamma vs std::lgamma, real z > 0", 1.E-13);
+    comparison batched("batched vs single lanczos_gamma", 1.E-15);
+
+    std::vector<std::complex<double>> batch, log_batch;
+    lanczos_gamma(z, batch);
+    lanczos_gamma(z, log_batch, 1);
+
+    for (int i = 0; i < z.size(); i++)
+    {
+        complex_gamma.add(lanczos_gamma(z[i]), cgamma(z[i]));
+        log_gamma.add(exp(lanczos_gamma(z[i], 1)), exp(cgamma(z[i], 1)));
+
+        batched.add(batch[i], lanczos_gamma(z[i]));
+        batched.add(log_batch[i], lanczos_gamma(z[i], 1));
+    }
+
+    for (int i = 0; i < x.size(); i++)
+    {
+        real_gamma.add(lanczos_gamma(x[i]), std::tgamma(x[i]));
+        if (x[i] > 0.) real_log.add(real(lanczos_gamma(x[i], 1)), std::lgamma(x[i]), 1.);
+    }
+
+    bool pass = true;
+    pass &= complex_gamma.report();
+    pass &= log_gamma.report();
+    pass &= real_gamma.report();
+    pass &= real_log.report();
+    pass &= batched.report();
+
+    // Timing over the complex grid
+    int N = 50;
+    std::complex<double> sum = 0.;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++)
+    {
+        for (int i = 0; i < z.size(); i++) sum += cgamma(z[i]);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int n = 0; n < N; n++)
+    {
+        for (int i = 0; i < z.size(); i++) sum += lanczos_gamma(z[i]);
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double t_cgamma  = std::chrono::duration<double, std::nano>(middle - start).count() / (N * z.size());
+    double t_lanczos = std::chrono::duration<double, std::nano>(stop - middle).count() / (N * z.size());
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "cgamma: " << t_cgamma << " ns, lanczos_gamma: " << t_lanczos << " ns per evaluation";
+    std::cout << " (checksum " << std::scientific << std::abs(sum) << ")" << std::endl;
+
+    return (pass) ? 0 : 1;
+};
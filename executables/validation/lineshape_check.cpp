@@ -0,0 +1,65 @@
+// ---------------------------------------------------------------------------
+// Compare the lineshape of every baryon resonance, evaluated on a fine grid in s
+// at fixed angle, against point-by-point evaluation of an independent copy.
+//
+// USAGE:
+// make lineshape_check && ./lineshape_check
+//
+// OUTPUT:
+// Largest deviation for each resonance, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+bool compare_lineshape(std::string name, baryon_resonance * scan, amplitude * single)
+{
+    reaction_kinematics * kinem = scan->_kinematics;
+
+    // Across the resonance region from threshold
+    std::vector<double> s;
+    for (double W = kinem->Wth() + 0.001; W < 5.; W += 0.002) s.push_back(W * W);
+
+    comparison c(name, 1.E-13);
+    for (int j = 0; j < TEST_THETA.size(); j++)
+    {
+        std::vector<std::vector<std::complex<double>>> lineshape;
+        scan->lineshape(s, TEST_THETA[j], lineshape);
+
+        for (int i = 0; i < s.size(); i++)
+        {
+            double t = kinem->t_man(s[i], TEST_THETA[j]);
+
+            std::vector<std::complex<double>> reference;
+            for (int k = 0; k < kinem->_nAmps; k++)
+            {
+                reference.push_back(single->helicity_amplitude(kinem->_helicities[k], s[i], t));
+            }
+
+            double scale = max_modulus(reference);
+            for (int k = 0; k < reference.size(); k++) c.add(lineshape[i][k], reference[k], scale);
+        }
+    }
+
+    return c.report();
+};
+
+int main( int argc, char** argv )
+{
+    test_amplitudes scan;
+    test_amplitudes single;
+
+    bool pass = true;
+    for (int n = 0; n < scan.size(); n++)
+    {
+        if (scan[n].name.find("resonance") != 0) continue;
+        pass &= compare_lineshape(scan[n].name, static_cast<baryon_resonance*>(scan[n].amp), single[n].amp);
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,164 @@
+// ---------------------------------------------------------------------------
+// Compare the contractions and expressions of lorentz_vector and lorentz_tensor with
+// the same sums written out explicitly over components for random complex arguments.
+// Useful to check the vectorized kernels of a given build (NATIVE_ARCH, SIMD_DISPATCH).
+//
+// USAGE:
+// make lorentz_check && ./lorentz_check
+//
+// OUTPUT:
+// Largest relative deviation for each operation
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "lorentz_vector.hpp"
+
+#include <random>
+
+using namespace jpacPhoto;
+
+std::mt19937 generator(2020);
+std::uniform_real_distribution<double> uniform(-2., 2.);
+
+std::complex<double> random_complex()
+{
+    return std::complex<double>(uniform(generator), uniform(generator));
+};
+
+lorentz_vector random_vector()
+{
+    return lorentz_vector(random_complex(), random_complex(), random_complex(), random_complex());
+};
+
+lorentz_tensor random_tensor()
+{
+    lorentz_tensor result;
+    for (int mu = 0; mu < 4; mu++)
+    {
+        for (int nu = 0; nu < 4; nu++) result.set(mu, nu, random_complex());
+    }
+    return result;
+};
+
+int main( int argc, char** argv )
+{
+    int N = 10000;
+
+    comparison dot("contract(a, b)", 1.E-14);
+    comparison tensor_vector("contract(T, b) and contract(a, T)", 1.E-14);
+    comparison outer_metric("outer(a, b) and metric()", 1.E-14);
+    comparison slashed("slash(a)", 1.E-14);
+    comparison fused("contract(a, T, b)", 1.E-14);
+    comparison epsilon("levi_civita(a, b, c)", 1.E-14);
+    comparison expressions("vector and tensor expressions", 1.E-14);
+
+    for (int n = 0; n < N; n++)
+    {
+        lorentz_vector a = random_vector(), b = random_vector(), c = random_vector();
+        lorentz_tensor T = random_tensor();
+
+        // a^mu g_{mu nu} b^nu
+        std::complex<double> ab = 0.;
+        for (int mu = 0; mu < 4; mu++) ab += a[mu] * METRIC[mu] * b[mu];
+        dot.add(contract(a, b), ab, 10.);
+
+        // T^{mu nu} b_nu and a_mu T^{mu nu}
+        lorentz_vector Tb = contract(T, b), aT = contract(a, T);
+        for (int mu = 0; mu < 4; mu++)
+        {
+            std::complex<double> Tb_mu = 0., aT_mu = 0.;
+            for (int nu = 0; nu < 4; nu++)
+            {
+                Tb_mu += T(mu, nu) * METRIC[nu] * b[nu];
+                aT_mu += a[nu] * METRIC[nu] * T(nu, mu);
+            }
+            tensor_vector.add(Tb[mu], Tb_mu, 10.);
+            tensor_vector.add(aT[mu], aT_mu, 10.);
+        }
+
+        // a^mu b^nu and g^{mu nu}
+        lorentz_tensor ab_outer = outer(a, b), g = metric();
+        for (int mu = 0; mu < 4; mu++)
+        {
+            for (int nu = 0; nu < 4; nu++)
+            {
+                outer_metric.add(ab_outer(mu, nu), a[mu] * b[nu], 10.);
+                outer_metric.add(g(mu, nu), (mu == nu) ? METRIC[mu] : 0., 1.);
+            }
+        }
+
+        // a_mu gamma^mu
+        std::complex<double> aslash[4][4];
+        slash(a, aslash);
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                std::complex<double> x = 0.;
+                for (int mu = 0; mu < 4; mu++) x += METRIC[mu] * a[mu] * GAMMA[mu][i][j];
+                slashed.add(aslash[i][j], x, 10.);
+            }
+        }
+
+        // a_mu T^{mu nu} b_nu in a single fused loop
+        std::complex<double> aTb = 0.;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            for (int nu = 0; nu < 4; nu++) aTb += METRIC[mu] * a[mu] * T(mu, nu) * METRIC[nu] * b[nu];
+        }
+        fused.add(contract(a, T, b), aTb, 100.);
+
+        // epsilon(mu, alpha, beta, gamma) a^alpha b^beta c^gamma summed over all 256 terms
+        lorentz_vector eps = levi_civita(a, b, c);
+        for (int mu = 0; mu < 4; mu++)
+        {
+            std::complex<double> eps_mu = 0.;
+            for (int alpha = 0; alpha < 4; alpha++)
+            {
+                for (int beta = 0; beta < 4; beta++)
+                {
+                    for (int gamma = 0; gamma < 4; gamma++)
+                    {
+                        eps_mu += levi_civita(mu, alpha, beta, gamma) * a[alpha] * b[beta] * c[gamma];
+                    }
+                }
+            }
+            epsilon.add(eps[mu], eps_mu, 100.);
+        }
+
+        // Nested expressions are only evaluated on assignment
+        std::complex<double> z = random_complex();
+        lorentz_vector x = (a + z * b - c / 3.).lower().conjugate();
+        lorentz_tensor X = outer(a, b) * z + metric() - T / 2.;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            expressions.add(x[mu], METRIC[mu] * std::conj(a[mu] + z * b[mu] - c[mu] / 3.), 10.);
+            for (int nu = 0; nu < 4; nu++)
+            {
+                std::complex<double> X_munu = a[mu] * b[nu] * z - T(mu, nu) / 2.;
+                if (mu == nu) X_munu += METRIC[mu];
+                expressions.add(X(mu, nu), X_munu, 10.);
+            }
+        }
+
+        // Aliasing the result with an argument
+        lorentz_vector y = a;
+        y = y.lower() + a;
+        for (int mu = 0; mu < 4; mu++) expressions.add(y[mu], (METRIC[mu] + 1.) * a[mu], 10.);
+    }
+
+    bool pass = true;
+    pass &= dot.report();
+    pass &= tensor_vector.report();
+    pass &= outer_metric.report();
+    pass &= slashed.report();
+    pass &= fused.report();
+    pass &= epsilon.report();
+    pass &= expressions.report();
+
+    return (pass) ? 0 : 1;
+};
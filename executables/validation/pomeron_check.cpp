@@ -0,0 +1,78 @@
+// ---------------------------------------------------------------------------
+// Compare the closed-form helicity amplitudes of pomeron exchange models 0 and 2
+// against the explicit contraction of the photon-vector-pomeron vertex with the nucleon current,
+// for the J/psi and a heavier vector with real and virtual photons.
+//
+// USAGE:
+// make pomeron_check && ./pomeron_check
+//
+// OUTPUT:
+// Largest deviation for each model and configuration, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+#include <sstream>
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+
+    linear_trajectory * alpha = new linear_trajectory(+1, 0.941, 0.364);
+
+    std::vector<double> masses = {M_JPSI, 4.2};
+    std::vector<double> Q2s = {0., 0.7};
+    std::vector<int> models = {0, 2};
+
+    for (int i = 0; i < masses.size(); i++)
+    {
+        for (int j = 0; j < Q2s.size(); j++)
+        {
+            reaction_kinematics * kinem = new reaction_kinematics(masses[i]);
+            kinem->set_JP(1, -1);
+            kinem->set_Q2(Q2s[j]);
+
+            for (int k = 0; k < models.size(); k++)
+            {
+                pomeron_exchange * analytic = new pomeron_exchange(kinem, alpha, models[k], "pomeron");
+                pomeron_exchange * covariant = new pomeron_exchange(kinem, alpha, models[k], "pomeron");
+                analytic->set_params({0.379, 0.12});
+                covariant->set_params({0.379, 0.12});
+                covariant->force_covariant(true);
+
+                std::stringstream label;
+                label << "model " << models[k] << ", mV = " << masses[i] << ", Q2 = " << Q2s[j];
+                comparison c(label.str(), 1.E-15);
+
+                for (double W = kinem->Wth() + 0.1; W < 21.; W += 1.7)
+                {
+                    double s = W * W;
+                    for (int n = 0; n < TEST_THETA.size(); n++)
+                    {
+                        double t = kinem->t_man(s, TEST_THETA[n]);
+
+                        std::vector<std::complex<double>> x, y;
+                        for (int h = 0; h < kinem->_nAmps; h++)
+                        {
+                            x.push_back(analytic->helicity_amplitude(kinem->_helicities[h], s, t));
+                            y.push_back(covariant->helicity_amplitude(kinem->_helicities[h], s, t));
+                        }
+
+                        double scale = std::max(max_modulus(x), max_modulus(y));
+                        for (int h = 0; h < x.size(); h++) c.add(x[h], y[h], scale);
+                    }
+                }
+
+                pass &= c.report();
+            }
+        }
+    }
+
+    return (pass) ? 0 : 1;
+};
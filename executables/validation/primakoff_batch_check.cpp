@@ -0,0 +1,95 @@
+// ---------------------------------------------------------------------------
+// Compare Primakoff observables of several nuclei evaluated together with primakoff_batch,
+// in parallel and serially, against a primakoff_effect set up by hand for each nucleus,
+// also after changing the photon virtuality and the coupling of the batch.
+//
+// USAGE:
+// make primakoff_batch_check && ./primakoff_batch_check
+//
+// OUTPUT:
+// Largest relative deviation for each nucleus and observable
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "nuclear_target.hpp"
+#include "amplitudes/primakoff_batch.hpp"
+
+#include <type_traits>
+
+using namespace jpacPhoto;
+
+// A copy would delete the kinematics and amplitudes of the original with it
+static_assert(!std::is_copy_constructible<primakoff_batch>::value && !std::is_copy_assignable<primakoff_batch>::value,
+              "primakoff_batch owns its amplitudes and must not be copied");
+
+int main( int argc, char** argv )
+{
+    std::vector<std::string> names = {"Zn70", "Sn124", "U238"};
+    double Q2 = 0.5, coupling = 3.2E-3;
+
+    primakoff_batch batch(M_X3872, names, Q2, coupling);
+
+    // Energies per nucleon and momentum transfers in the forward peak
+    std::vector<double> W = {1.5, 3., 5.};
+    std::vector<double> t = {-2.E-3, -5.E-3, -1.E-2, -3.E-2};
+
+    bool pass = true;
+    std::vector<std::string> changes = {"", "Q2", "coupling"};
+    for (int n = 0; n < changes.size(); n++)
+    {
+        if (changes[n] == "Q2")       { Q2 = 1.; batch.set_Q2(Q2); };
+        if (changes[n] == "coupling") { coupling = 5.E-3; batch.set_coupling(coupling); };
+
+        for (int LT = 0; LT <= 1; LT++)
+        {
+            batch.set_LT(LT);
+
+            batch.set_parallel(true);
+            std::vector<std::vector<double>> sigma = batch.integrated_xsection(W, true);
+            std::vector<std::vector<double>> dsigma = batch.differential_xsection(W[1], t, true);
+
+            batch.set_parallel(false);
+            std::vector<std::vector<double>> sigma_serial = batch.integrated_xsection(W, true);
+
+            for (int i = 0; i < names.size(); i++)
+            {
+                nuclear_target target = nuclear_target::get(names[i]);
+
+                reaction_kinematics * kinem = new reaction_kinematics(M_X3872, target._mass, target._mass);
+                kinem->set_JP(1, 1);
+                kinem->set_Q2(Q2);
+
+                primakoff_effect * single = new primakoff_effect(kinem);
+                single->set_params({double(target._Z), target._radius, target._skin, coupling});
+                single->set_LT(LT);
+
+                std::string label = names[i] + ((LT == 0) ? ", longitudinal" : ", transverse");
+                if (changes[n] != "") label += " after changing " + changes[n];
+
+                comparison c(label, 1.E-12);
+                for (int j = 0; j < W.size(); j++)
+                {
+                    double s = pow(target._A * W[j], 2.);
+                    c.add(sigma[i][j], single->integrated_xsection(s));
+                    c.add(sigma_serial[i][j], sigma[i][j]);
+                }
+                for (int j = 0; j < t.size(); j++)
+                {
+                    c.add(dsigma[i][j], single->differential_xsection(pow(target._A * W[1], 2.), t[j]));
+                }
+                pass &= c.report();
+
+                // Through the base class, which must also destroy the derived class
+                amplitude * base = single;
+                delete base;
+                delete kinem;
+            }
+        }
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,162 @@
+// ---------------------------------------------------------------------------
+// Compare the lab-frame kinematics of primakoff_effect, evaluated in double precision,
+// against the direct formulas (with all their cancellations) evaluated in quad precision,
+// off a proton and Zn, Sn and U nuclei from threshold up to 5 GeV per nucleon.
+//
+// The form factor only depends on t, so it cancels in ratios of cross-sections at the same t:
+// - transverse photons at Q2 = 0 and 2 relative to Q2 = 0.5
+// - longitudinal relative to transverse photons at Q2 = 0.5 and 2
+// which are compared to the same ratios of the quad precision amplitudes and flux factors.
+//
+// Requires GCC's __float128 (e.g. on x86_64), otherwise nothing is checked.
+//
+// USAGE:
+// make primakoff_kinematics_check && ./primakoff_kinematics_check
+//
+// OUTPUT:
+// Largest relative deviation of each ratio for each target
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "nuclear_target.hpp"
+#include "amplitudes/primakoff_effect.hpp"
+
+using namespace jpacPhoto;
+
+#ifdef __SIZEOF_FLOAT128__
+
+typedef __float128 quad;
+
+// Newton iterations from the double precision result
+quad sqrt_quad(quad x)
+{
+    if (x <= 0) return 0;
+
+    quad result = sqrt(double(x));
+    for (int i = 0; i < 3; i++) result = (result + x / result) / 2;
+    return result;
+};
+
+// Everything in dsigma/dt which does not depend only on t:
+// |amplitude|^2 / (pGam (2 mA nu - Q2)) with the lab frame kinematics written out directly
+quad kinematic_factor(double s, double t, reaction_kinematics * kinem, int LT)
+{
+    quad mA2 = kinem->_mT2, mX2 = kinem->_mX2, Q2 = -kinem->_mB2;
+    quad mA  = sqrt_quad(mA2);
+
+    quad nu   = (s - mA2 + Q2) / (2 * mA);
+    quad pGam = sqrt_quad(nu*nu + Q2);
+    quad pX   = sqrt_quad(quad(t)*t + 4*mA*t*nu + 4*mA2*(nu*nu - mX2)) / (2*mA);
+    quad enX  = sqrt_quad(pX*pX + mX2);
+    quad cosX = (t + Q2 - mX2 + 2*nu*enX) / (2*pX*pGam);
+    quad sinX2 = 1 - cosX*cosX;
+
+    quad result;
+    if (LT == 0)
+    {
+        result = pX*pX * Q2 * enX*enX * sinX2;
+    }
+    else
+    {
+        quad cosHalfX2 = (1 + cosX) / 2, sinHalfX2 = (1 - cosX) / 2;
+        quad symC  = pX*pGam*(pX + pGam) + enX*nu*(pGam - pX) - 2*pX*pGam*pGam*cosX;
+        quad symS  = pX*pGam*(pX - pGam) + enX*nu*(pGam + pX) - 2*pX*pGam*pGam*cosX;
+        quad inner = pGam * (nu*(mX2 + 2*pX*pX) - 2*enX*pX*pGam*cosX);
+
+        result  = cosHalfX2 * symC*symC * cosHalfX2;
+        result += sinHalfX2 * symS*symS * sinHalfX2;
+        result += inner*inner / (2*mX2) * sinX2;
+    }
+
+    return result / (pGam * (2*mA*nu - Q2));
+};
+
+// Ratio of cross-sections (a / b) at the same s and t compared with the ratio of kinematic factors
+void compare_ratio(primakoff_effect * a, primakoff_effect * b, int LTa, int LTb, double s, double t, comparison & c)
+{
+    quad ratio = kinematic_factor(s, t, a->_kinematics, LTa) / kinematic_factor(s, t, b->_kinematics, LTb);
+    c.add(a->differential_xsection(s, t) / b->differential_xsection(s, t), double(ratio));
+};
+
+int main( int argc, char** argv )
+{
+    // The form factor cancels so any parameters will do
+    std::vector<double> params = {30, 22.34, 2.954, 3.2E-3};
+
+    std::vector<std::string> names = {"proton", "Zn70", "Sn124", "U238"};
+    std::vector<double> Q2 = {0., 0.5, 2.};
+
+    bool pass = true;
+    for (int n = 0; n < names.size(); n++)
+    {
+        double mA = (n == 0) ? M_PROTON : nuclear_target::get(names[n])._mass;
+        int A     = (n == 0) ? 1        : nuclear_target::get(names[n])._A;
+
+        // Amplitudes for each Q2 and photon projection
+        std::vector<reaction_kinematics*> kinem;
+        std::vector<std::array<primakoff_effect*, 2>> amps;
+        for (int i = 0; i < Q2.size(); i++)
+        {
+            kinem.push_back(new reaction_kinematics(M_X3872, mA, mA));
+            kinem[i]->set_JP(1, 1);
+            kinem[i]->set_Q2(Q2[i]);
+
+            std::array<primakoff_effect*, 2> amp;
+            for (int LT = 0; LT <= 1; LT++)
+            {
+                amp[LT] = new primakoff_effect(kinem[i]);
+                amp[LT]->set_params(params);
+                amp[LT]->set_LT(LT);
+            }
+            amps.push_back(amp);
+        }
+
+        comparison T0(names[n] + ", transverse Q2 = 0 / Q2 = 0.5", 5.E-13);
+        comparison T2(names[n] + ", transverse Q2 = 2 / Q2 = 0.5", 5.E-13);
+        comparison L05(names[n] + ", longitudinal / transverse at Q2 = 0.5", 1.E-8);
+        comparison L2(names[n] + ", longitudinal / transverse at Q2 = 2", 1.E-8);
+
+        for (double x : {1.001, 1.01, 1.1, 1.5, 2., 5.})
+        {
+            // Above the threshold of the largest Q2, and at energies per nucleon for the nuclei
+            double W = std::max(kinem[2]->Wth() * x, A * x);
+            double s = W * W;
+
+            // Every t must be physical for all Q2, which t_min of the largest Q2 ensures
+            double t_min = kinem[2]->t_man(s, 0.), t_max = kinem[2]->t_man(s, PI);
+            for (double f = 1.E-9; f < 1.; f *= 3.)
+            {
+                double t = t_min + f * (t_max - t_min);
+
+                compare_ratio(amps[0][1], amps[1][1], 1, 1, s, t, T0);
+                compare_ratio(amps[2][1], amps[1][1], 1, 1, s, t, T2);
+
+                // The longitudinal amplitude is proportional to t_min - t, so closer to t_min
+                // than this the rounding of t_min itself dominates
+                if (kinem[1]->t_man(s, 0.) - t > 1.E-6 * std::abs(t_min)) compare_ratio(amps[1][0], amps[1][1], 0, 1, s, t, L05);
+                if (kinem[2]->t_man(s, 0.) - t > 1.E-6 * std::abs(t_min)) compare_ratio(amps[2][0], amps[2][1], 0, 1, s, t, L2);
+            }
+        }
+
+        pass &= T0.report();
+        pass &= T2.report();
+        pass &= L05.report();
+        pass &= L2.report();
+    }
+
+    return (pass) ? 0 : 1;
+};
+
+#else
+
+int main( int argc, char** argv )
+{
+    std::cout << "primakoff_kinematics_check: __float128 is not available with this compiler. Nothing checked.\n";
+    return 0;
+};
+
+#endif
@@ -0,0 +1,166 @@
+// ---------------------------------------------------------------------------
+// Compare the spin-3/2 propagator matrix saved by rarita_exchange after evaluating
+// a helicity amplitude against a direct sum over the Lorentz indices mu, nu of
+//   (p-slash + m) [ - k.g_bar.k' + (k.g_bar.gamma)(gamma.g_bar.k') / 3 ] / (p^2 - m^2)
+// over a scan in s and t, forwards and backwards, and after changing the produced mass.
+//
+// USAGE:
+// make rarita_check && ./rarita_check
+//
+// OUTPUT:
+// Largest deviation relative to the largest element of the propagator at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "gamma_matrices.hpp"
+
+using namespace jpacPhoto;
+
+// rarita_exchange with access to its saved propagator
+class rarita_probe : public rarita_exchange
+{
+    public:
+    rarita_probe(reaction_kinematics * xkinem, double mass)
+    : rarita_exchange(xkinem, mass, "probe")
+    {};
+
+    // Evaluate one helicity amplitude and compare the propagator it saved with the direct sum
+    void compare(double s, double t, comparison & c)
+    {
+        helicity_amplitude(_kinematics->_helicities[0], s, t);
+
+        std::complex<double> direct[4][4];
+        direct_propagator(direct);
+
+        double scale = 0.;
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++) scale = std::max(scale, std::abs(direct[i][j]));
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++) c.add(_propagator[i][j], direct[i][j], scale);
+        }
+    };
+
+    private:
+    // Every contraction written out in components at the saved s and theta
+    void direct_propagator(std::complex<double> result[4][4])
+    {
+        std::complex<double> p[4], k_in[4], k_out[4];
+        for (int mu = 0; mu < 4; mu++)
+        {
+            p[mu]     = _kinematics->u_exchange_momentum(mu, _s, _theta);
+            k_in[mu]  = METRIC[mu] * relative_momentum(kInitial)[mu];
+            k_out[mu] = METRIC[mu] * relative_momentum(kFinal)[mu];
+        }
+
+        // g_bar^{mu nu} and g_bar^{mu nu} gamma_nu
+        std::complex<double> g_bar[4][4], slashed_g_bar[4][4][4];
+        for (int mu = 0; mu < 4; mu++)
+        {
+            for (int nu = 0; nu < 4; nu++)
+            {
+                g_bar[mu][nu] = p[mu] * p[nu] / _mEx2;
+                if (mu == nu) g_bar[mu][nu] -= METRIC[mu];
+            }
+
+            for (int i = 0; i < 4; i++)
+            {
+                for (int j = 0; j < 4; j++)
+                {
+                    slashed_g_bar[mu][i][j] = 0.;
+                    for (int nu = 0; nu < 4; nu++) slashed_g_bar[mu][i][j] += g_bar[mu][nu] * METRIC[nu] * GAMMA[nu][i][j];
+                }
+            }
+        }
+
+        std::complex<double> kgk = 0.;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            for (int nu = 0; nu < 4; nu++) kgk += k_in[mu] * g_bar[mu][nu] * k_out[nu];
+        }
+
+        // (p-slash + m) / (p^2 - m^2)
+        std::complex<double> p2 = 0.;
+        for (int mu = 0; mu < 4; mu++) p2 += METRIC[mu] * p[mu] * p[mu];
+
+        std::complex<double> dirac[4][4];
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                dirac[i][j] = (i == j) ? _mEx : 0.;
+                for (int mu = 0; mu < 4; mu++) dirac[i][j] += METRIC[mu] * p[mu] * GAMMA[mu][i][j];
+                dirac[i][j] /= real(p2) - _mEx2;
+            }
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                result[i][j] = 0.;
+                for (int k = 0; k < 4; k++)
+                {
+                    std::complex<double> bracket = (k == j) ? -kgk : 0.;
+                    for (int l = 0; l < 4; l++)
+                    {
+                        for (int mu = 0; mu < 4; mu++)
+                        {
+                            for (int nu = 0; nu < 4; nu++)
+                            {
+                                bracket += k_in[mu] * slashed_g_bar[mu][k][l] * slashed_g_bar[nu][l][j] * k_out[nu] / 3.;
+                            }
+                        }
+                    }
+
+                    result[i][j] += dirac[i][k] * bracket;
+                }
+            }
+        }
+    };
+};
+
+int main( int argc, char** argv )
+{
+    reaction_kinematics * kDstar = new reaction_kinematics(M_DSTAR, M_LAMBDAC, M_PROTON);
+    kDstar->set_JP(1, -1);
+
+    rarita_probe * sigc = new rarita_probe(kDstar, 2.5);
+    sigc->set_params({0.3, -2.});
+
+    bool pass = true;
+    std::vector<std::string> changes = {"", "mX"};
+    for (int n = 0; n < changes.size(); n++)
+    {
+        if (changes[n] == "mX") kDstar->set_mX(M_DSTAR + 0.2);
+
+        std::vector<std::array<double, 2>> points;
+        for (double W = kDstar->Wth() + 0.1; W < 20.; W += 1.3)
+        {
+            for (int j = 0; j < TEST_THETA.size(); j++)
+            {
+                double s = W * W;
+                points.push_back({{s, kDstar->t_man(s, TEST_THETA[j])}});
+            }
+        }
+
+        std::string label = "Rarita-Schwinger propagator" + ((changes[n] == "") ? "" : " after changing " + changes[n]);
+        comparison c(label, 1.E-15);
+        for (int i = 0; i < 2 * points.size(); i++)
+        {
+            int m = (i < points.size()) ? i : 2 * points.size() - 1 - i;
+            sigc->compare(points[m][0], points[m][1], c);
+        }
+
+        pass &= c.report();
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,106 @@
+// ---------------------------------------------------------------------------
+// Compare reggeized amplitudes which reuse their saved t-dependent factors
+// over a scan in s and t with newly constructed amplitudes at each point,
+// also after changing the trajectory, the photon virtuality, the produced mass and the couplings.
+//
+// USAGE:
+// make regge_cache_check && ./regge_cache_check
+//
+// OUTPUT:
+// Largest deviation for each amplitude and change, relative to the largest amplitude at each point
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+
+    // Reggeized rho exchange in X(3872) production
+    reaction_kinematics * kX = new reaction_kinematics(M_X3872);
+    kX->set_JP(1, 1);
+
+    linear_trajectory * alpha = new linear_trajectory(-1, 0.5, 0.9);
+    std::vector<double> couplings = {3.6E-3, 2.4, 14.6};
+
+    vector_exchange * rho = new vector_exchange(kX, alpha, "rho");
+    rho->set_params(couplings);
+
+    auto fresh_rho = [&]() -> amplitude *
+    {
+        vector_exchange * x = new vector_exchange(kX, alpha, "rho");
+        x->set_params(couplings);
+        return x;
+    };
+
+    // Pomeron exchange, all three models
+    reaction_kinematics * kPsi = new reaction_kinematics(M_JPSI);
+    kPsi->set_JP(1, -1);
+
+    linear_trajectory * alphaP = new linear_trajectory(+1, 0.941, 0.364);
+    std::vector<double> pomeron_couplings = {0.379, 0.12};
+
+    std::vector<pomeron_exchange*> pomerons;
+    for (int m = 0; m < 3; m++)
+    {
+        pomerons.push_back(new pomeron_exchange(kPsi, alphaP, m, "pomeron"));
+        pomerons[m]->set_params(pomeron_couplings);
+    }
+
+    // Compare with new amplitudes after each change
+    std::vector<std::string> changes = {"", "trajectory", "Q2", "mX", "couplings"};
+    for (int n = 0; n < changes.size(); n++)
+    {
+        if (changes[n] == "trajectory")
+        {
+            alpha->set_params(0.45, 0.85);
+            alphaP->set_params(1.08, 0.25);
+        }
+        if (changes[n] == "Q2")
+        {
+            kX->set_Q2(0.5);
+            kPsi->set_Q2(0.7);
+        }
+        if (changes[n] == "mX")
+        {
+            kX->set_mX(M_CHIC1);
+            kPsi->set_mX(M_PSI2S);
+        }
+        if (changes[n] == "couplings")
+        {
+            couplings = {5.2E-4, 2.4, 14.6};
+            rho->set_params(couplings);
+
+            pomeron_couplings = {0.5, 0.2};
+            for (int m = 0; m < 3; m++) pomerons[m]->set_params(pomeron_couplings);
+        }
+
+        std::string label = (changes[n] == "") ? "" : " after changing " + changes[n];
+
+        comparison c("reggeized rho" + label, 1.E-13);
+        compare_with_new(rho, fresh_rho, c);
+        pass &= c.report();
+
+        for (int m = 0; m < 3; m++)
+        {
+            auto fresh_pomeron = [&]() -> amplitude *
+            {
+                pomeron_exchange * x = new pomeron_exchange(kPsi, alphaP, m, "pomeron");
+                x->set_params(pomeron_couplings);
+                return x;
+            };
+
+            comparison c("pomeron model " + std::to_string(m) + label, 1.E-13);
+            compare_with_new(pomerons[m], fresh_pomeron, c);
+            pass &= c.report();
+        }
+    }
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------------
+// Reggeized vector and pseudoscalar exchange for quantum numbers without analytic residues
+// (vector, scalar and pseudoscalar production) are built from the Feynman rules vertices
+// with the Regge propagator in place of the pole. With elastic nucleon vertices every
+// helicity amplitude is then the fixed-spin one times the same ratio of propagators,
+// which is compared against a direct evaluation of
+//      alpha' 1/2 (signature + exp(-i pi alpha)) Gamma(J - alpha) s^(alpha - J) (t - m^2)
+// for a trajectory with alpha(m^2) = J. Polarized observables and the interference with
+// a pomeron amplitude then have to agree with the fixed-spin amplitude as well.
+//
+// USAGE:
+// make regge_covariant_check && ./regge_covariant_check
+//
+// OUTPUT:
+// Largest relative deviation for each comparison
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+// Ratio of the Regge propagator to the pole 1 / (t - m2) for a spin-J exchange
+std::complex<double> propagator_ratio(int J, int signature, double a0, double aprime, double s, double t)
+{
+    double alpha = a0 + aprime * t;
+    double m2    = (double(J) - a0) / aprime;
+
+    // alpha < J in the physical region so Gamma(J - alpha) is positive,
+    // combined with the power of s in logs so neither overflows at large |t|
+    std::complex<double> result = 0.5 * (double(signature) + exp(- XI * PI * alpha));
+    result *= aprime * exp(lgamma(double(J) - alpha) + (alpha - double(J)) * log(s));
+    result *= t - m2;
+
+    // pseudoscalar_exchange carries the sign of the Feynman propagator in its Regge form
+    return (J == 0) ? - result : result;
+};
+
+// Fixed-spin amplitude (a) and the same exchange reggeized (b)
+bool compare(std::string name, int J, int signature, double a0, double aprime, amplitude * a, amplitude * b)
+{
+    reaction_kinematics * kinem = a->_kinematics;
+
+    comparison amplitudes(name + ", helicity amplitudes", 1.E-10);
+    comparison observables(name + ", polarized observables", 1.E-9);
+
+    for (int i = 0; i < TEST_W.size(); i++)
+    {
+        double s = TEST_W[i] * TEST_W[i];
+        if (sqrt(s) < kinem->Wth() + 0.1) continue;
+
+        for (int j = 0; j < TEST_THETA.size(); j++)
+        {
+            double t = kinem->t_man(s, TEST_THETA[j]);
+            std::complex<double> ratio = propagator_ratio(J, signature, a0, aprime, s, t);
+
+            std::vector<std::complex<double>> x, y;
+            for (int k = 0; k < kinem->_nAmps; k++)
+            {
+                x.push_back(ratio * a->helicity_amplitude(kinem->_helicities[k], s, t));
+                y.push_back(b->helicity_amplitude(kinem->_helicities[k], s, t));
+            }
+
+            double scale = std::max(max_modulus(x), max_modulus(y));
+            for (int k = 0; k < x.size(); k++) amplitudes.add(x[k], y[k], scale);
+
+            // Observables are ratios of squared amplitudes, skipped at large |t| where the
+            // Regge amplitudes are too small to be squared in double precision.
+            // The observables in the library are only defined for vector meson production.
+            // Dimensionless, so compared on an absolute scale of one
+            if (kinem->_jp[0] != 1 || max_modulus(y) < 1.E-100) continue;
+            observables.add(a->beam_asymmetry_4pi(s, t), b->beam_asymmetry_4pi(s, t), 1.);
+            observables.add(a->parity_asymmetry(s, t),   b->parity_asymmetry(s, t), 1.);
+            observables.add(a->A_LL(s, t),               b->A_LL(s, t), 1.);
+            observables.add(a->SDME(0, 1, -1, s, t),     b->SDME(0, 1, -1, s, t), 1.);
+            observables.add(a->SDME(1, 1, -1, s, t),     b->SDME(1, 1, -1, s, t), 1.);
+        }
+    }
+
+    bool pass = amplitudes.report();
+    if (kinem->_jp[0] == 1) pass &= observables.report();
+    return pass;
+};
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+
+    // Trajectories through the exchanged masses
+    double aprime = 0.9;
+    linear_trajectory alphaRho  (-1, 1. - aprime * M_RHO * M_RHO, aprime);
+    linear_trajectory alphaOmega(-1, 1. - aprime * M_OMEGA * M_OMEGA, aprime);
+    linear_trajectory alphaPi   (+1, - 0.7 * M2_PION, 0.7);
+
+    // V-V-V, omega exchange in J/psi photoproduction
+    reaction_kinematics * kPsi = new reaction_kinematics(M_JPSI);
+    kPsi->set_JP(1, -1);
+
+    vector_exchange * omegaV  = new vector_exchange(kPsi, M_OMEGA, "omega");
+    vector_exchange * omegaVR = new vector_exchange(kPsi, &alphaOmega, "omega");
+    omegaV->set_params({0.01, 16., 0.});
+    omegaVR->set_params({0.01, 16., 0.});
+    pass &= compare("V-V-V, omega", 1, -1, alphaOmega.eval(0.).real(), aprime, omegaV, omegaVR);
+
+    // S-V-V, rho exchange with vector and tensor couplings
+    reaction_kinematics * kS = new reaction_kinematics(M_CHIC1 - 0.1);
+    kS->set_JP(0, 1);
+
+    vector_exchange * rhoS  = new vector_exchange(kS, M_RHO, "rho");
+    vector_exchange * rhoSR = new vector_exchange(kS, &alphaRho, "rho");
+    rhoS->set_params({0.1, 2.4, 14.6});
+    rhoSR->set_params({0.1, 2.4, 14.6});
+    pass &= compare("S-V-V, rho", 1, -1, alphaRho.eval(0.).real(), aprime, rhoS, rhoSR);
+
+    // P-V-V, rho exchange in eta photoproduction
+    reaction_kinematics * kEta = new reaction_kinematics(M_ETA);
+    kEta->set_JP(0, -1);
+
+    vector_exchange * rhoP  = new vector_exchange(kEta, M_RHO, "rho");
+    vector_exchange * rhoPR = new vector_exchange(kEta, &alphaRho, "rho");
+    rhoP->set_params({0.8, 2.4, 14.6});
+    rhoPR->set_params({0.8, 2.4, 14.6});
+    pass &= compare("P-V-V, rho", 1, -1, alphaRho.eval(0.).real(), aprime, rhoP, rhoPR);
+
+    // V-V-P, pion exchange in J/psi photoproduction
+    pseudoscalar_exchange * piV  = new pseudoscalar_exchange(kPsi, M_PION, "pi");
+    pseudoscalar_exchange * piVR = new pseudoscalar_exchange(kPsi, &alphaPi, "pi");
+    piV->set_params({0.01, sqrt(4. * PI * 13.81)});
+    piVR->set_params({0.01, sqrt(4. * PI * 13.81)});
+    pass &= compare("V-V-P, pion", 0, +1, alphaPi.eval(0.).real(), 0.7, piV, piVR);
+
+    // Interference with the pomeron, which fixes the phase relative to other amplitudes
+    linear_trajectory alphaP(+1, 0.941, 0.364);
+    pomeron_exchange * pom = new pomeron_exchange(kPsi, &alphaP, 0, "pomeron");
+    pom->set_params({0.379, 0.12});
+
+    // Couplings for which both terms are comparable at forward angles
+    omegaV->set_params({0.1, 16., 0.});
+    omegaVR->set_params({0.1, 16., 0.});
+    amplitude_sum * sum = new amplitude_sum(kPsi, {pom, omegaVR}, "sum");
+
+    comparison interference("V-V-V + pomeron, helicity amplitudes", 1.E-10);
+    comparison interferenceObs("V-V-V + pomeron, sum of |A|^2", 1.E-9);
+    for (int i = 0; i < TEST_W.size(); i++)
+    {
+        double s = TEST_W[i] * TEST_W[i];
+        if (sqrt(s) < kPsi->Wth() + 0.1) continue;
+
+        for (int j = 0; j < TEST_THETA.size(); j++)
+        {
+            double t = kPsi->t_man(s, TEST_THETA[j]);
+            std::complex<double> ratio = propagator_ratio(1, -1, alphaOmega.eval(0.).real(), aprime, s, t);
+
+            double norm = 0.;
+            std::vector<std::complex<double>> x, y;
+            for (int k = 0; k < kPsi->_nAmps; k++)
+            {
+                std::array<int, 4> hel = kPsi->_helicities[k];
+                x.push_back(pom->helicity_amplitude(hel, s, t) + ratio * omegaV->helicity_amplitude(hel, s, t));
+                y.push_back(sum->helicity_amplitude(hel, s, t));
+                norm += std::norm(x.back());
+            }
+
+            double scale = std::max(max_modulus(x), max_modulus(y));
+            for (int k = 0; k < x.size(); k++) interference.add(x[k], y[k], scale);
+
+            interferenceObs.add(norm, sum->probability_distribution(s, t));
+        }
+    }
+    pass &= interference.report();
+    pass &= interferenceObs.report();
+
+    delete sum;
+    delete pom;
+    delete omegaV; delete omegaVR;
+    delete rhoS;   delete rhoSR;
+    delete rhoP;   delete rhoPR;
+    delete piV;    delete piVR;
+    delete kPsi;   delete kS;    delete kEta;
+
+    return (pass) ? 0 : 1;
+};
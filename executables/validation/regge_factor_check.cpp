@@ -0,0 +1,97 @@
+// ---------------------------------------------------------------------------
+// Compare regge_factor(), which combines Gamma(n - alpha) and s^(alpha - m) in log space,
+// with the direct product of cgamma and pow where neither overflows,
+// and with a log-space reference far past where they would.
+// Also checks reggeized amplitudes stay finite at large momentum transfers.
+//
+// USAGE:
+// make regge_factor_check && ./regge_factor_check
+//
+// OUTPUT:
+// Largest relative deviation for each check
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "misc_math.hpp"
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    std::vector<double> energies = {5., 25., 400.};
+
+    comparison direct("regge_factor vs cgamma * pow, -20 < Re alpha < 5", 1.E-12);
+    comparison logspace("log |regge_factor| vs lgamma, -300 < alpha < -20", 1.E-12);
+    comparison finite("reggeized amplitudes finite up to -t = 50 GeV^2", 0.);
+
+    for (int sig = -1; sig <= 1; sig += 2)
+    {
+        for (int n = 0; n <= 1; n++)
+        {
+            for (int m = 0; m <= 1; m++)
+            {
+                for (int i = 0; i < energies.size(); i++)
+                {
+                    double s = energies[i];
+
+                    // Non-integer real parts keep away from the poles of Gamma(n - alpha)
+                    for (double x = -19.93; x < 5.; x += 0.37)
+                    {
+                        for (double y = -1.; y <= 1.; y += 0.5)
+                        {
+                            std::complex<double> alpha(x, y);
+                            std::complex<double> signature = 0.5 * (double(sig) + exp(-XI * PI * alpha));
+                            std::complex<double> reference = signature * cgamma(double(n) - alpha) * pow(s, alpha - double(m));
+
+                            direct.add(regge_factor(sig, alpha, n, s, m), reference);
+                        }
+                    }
+
+                    // Here Gamma(n - alpha) and s^alpha separately overflow and underflow
+                    // cgamma saturates for large arguments so the reference uses std::lgamma on the real axis
+                    for (double x = -300.13; x < -20.; x += 3.7)
+                    {
+                        std::complex<double> signature = 0.5 * (double(sig) + exp(-XI * PI * x));
+                        double reference = log(std::abs(signature)) + std::lgamma(double(n) - x) + (x - double(m)) * log(s);
+
+                        // Only where the product itself is representable
+                        if (std::abs(reference) > 700.) continue;
+
+                        logspace.add(log(std::abs(regge_factor(sig, x, n, s, m))), reference);
+                    }
+                }
+            }
+        }
+    }
+
+    // Amplitudes past the old cutoffs in alpha
+    test_amplitudes amps;
+    for (int n = 0; n < amps.size(); n++)
+    {
+        if (amps[n].name != "vector_axial_regge" && amps[n].name != "pseudoscalar_axial_regge") continue;
+
+        amplitude * amp = amps[n].amp;
+        for (double W = 5.; W <= 50.; W += 5.)
+        {
+            double s = W * W;
+            double t_min = amp->_kinematics->t_man(s, 0.), t_max = amp->_kinematics->t_man(s, PI);
+
+            for (double t = t_min; t > std::max(t_max, -50.); t -= 1.)
+            {
+                double dxs = amp->differential_xsection(s, t);
+                finite.add((std::isfinite(dxs)) ? 0. : 1., 0.);
+            }
+        }
+    }
+
+    bool pass = true;
+    pass &= direct.report();
+    pass &= logspace.report();
+    pass &= finite.report();
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,246 @@
+// ---------------------------------------------------------------------------
+// Compare sums of amplitudes, which reuse the cached helicity amplitudes of their terms,
+// with newly constructed sums after changing the couplings, trajectories, debug modes
+// and photon virtuality, and count how often a background shared between several sums is evaluated.
+//
+// USAGE:
+// make sum_cache_check && ./sum_cache_check
+//
+// OUTPUT:
+// Largest deviation for each change, relative to the largest amplitude at each point,
+// and the number of evaluations of each term against the expected number
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+
+using namespace jpacPhoto;
+
+// Vector exchange which counts how often all of its helicity amplitudes are evaluated
+class counting_exchange : public vector_exchange
+{
+    public:
+    counting_exchange(reaction_kinematics * xkinem, double mass)
+    : vector_exchange(xkinem, mass, "counting")
+    {};
+
+    int _evaluations = 0;
+
+    void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+    {
+        _evaluations++;
+        amplitude::helicity_amplitudes(s, t, result);
+    };
+    using amplitude::helicity_amplitudes;
+};
+
+// Observables at a point saved before a change and helicity amplitudes over a scan after it
+bool compare_sum(std::string label, amplitude_sum * sum, std::function<amplitude*()> make_sum, double s, double t)
+{
+    amplitude * fresh = make_sum();
+
+    comparison observable(label + ", dsigma/dt at the saved point", 1.E-13);
+    observable.add(sum->differential_xsection(s, t), fresh->differential_xsection(s, t));
+    delete fresh;
+
+    comparison scan(label + ", helicity amplitudes", 1.E-13);
+    compare_with_new(sum, make_sum, scan);
+
+    bool pass = true;
+    pass &= observable.report();
+    pass &= scan.report();
+    return pass;
+};
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+
+    // Pomeron background with two pentaquarks
+    reaction_kinematics * kPsi = new reaction_kinematics(M_JPSI);
+    kPsi->set_JP(1, -1);
+
+    linear_trajectory * alphaP = new linear_trajectory(+1, 0.941, 0.364);
+    std::vector<double> pomeron_couplings = {0.379, 0.12};
+    std::vector<double> pentaquark_couplings = {0.01, 0.7071};
+
+    pomeron_exchange * pomeron;
+    auto make_psi_sum = [&]() -> amplitude_sum *
+    {
+        // The resonances fix their photon momentum at the resonance mass on construction,
+        // so make them for a real photon like the original ones
+        double Q2 = -kPsi->_mB2;
+        kPsi->set_Q2(0.);
+        baryon_resonance * pc1 = new baryon_resonance(kPsi, 1, 1, 4.45, 0.02, "P_c");
+        baryon_resonance * pc3 = new baryon_resonance(kPsi, 3, -1, 4.38, 0.205, "P_c");
+        kPsi->set_Q2(Q2);
+
+        pomeron_exchange * pom = new pomeron_exchange(kPsi, alphaP, 1, "pomeron");
+        pom->set_params(pomeron_couplings);
+        pc1->set_params(pentaquark_couplings);
+        pc3->set_params(pentaquark_couplings);
+        pomeron = pom;
+        return new amplitude_sum(kPsi, {pom, pc1, pc3}, "sum");
+    };
+    amplitude_sum * psi_sum = make_psi_sum();
+    pomeron_exchange * psi_pomeron = pomeron;
+
+    // D* exchange with Lambda_c exchange in the u-channel
+    reaction_kinematics * kDstar = new reaction_kinematics(M_DSTAR, M_LAMBDAC, M_PROTON);
+    kDstar->set_JP(1, -1);
+
+    int debug = 0;
+    dirac_exchange * lambdac;
+    auto make_dstar_sum = [&]() -> amplitude_sum *
+    {
+        vector_exchange * dstar = new vector_exchange(kDstar, M_DSTAR, "D*");
+        dirac_exchange * lamc = new dirac_exchange(kDstar, M_LAMBDAC, "Lambda_c");
+        dstar->set_params({0.641, -13.2, 0.3});
+        lamc->set_params({sqrt(4. * PI * ALPHA), -13.2});
+        if (debug > 0) lamc->set_debug(debug);
+        lambdac = lamc;
+        return new amplitude_sum(kDstar, {dstar, lamc}, "sum");
+    };
+    amplitude_sum * dstar_sum = make_dstar_sum();
+    dirac_exchange * dstar_lambdac = lambdac;
+
+    // Every change is made right after evaluating every term of the sums at a point, which is then evaluated again.
+    // Pentaquarks are compared on top of their peak so they are not negligible next to the pomeron
+    double s_psi = 4.45 * 4.45, t_psi = kPsi->t_man(s_psi, 0.5);
+    double s = 100., t = -1.;
+    std::vector<std::complex<double>> saved;
+    std::vector<std::string> changes = {"", "couplings", "trajectory", "Q2", "debug mode"};
+    for (int n = 0; n < changes.size(); n++)
+    {
+        psi_sum->helicity_amplitudes(s_psi, t_psi, saved);
+        dstar_sum->helicity_amplitudes(s, t, saved);
+
+        if (changes[n] == "couplings")
+        {
+            pomeron_couplings = {0.5, 0.2};
+            psi_pomeron->set_params(pomeron_couplings);
+        }
+        if (changes[n] == "trajectory") alphaP->set_params(1.08, 0.25);
+        if (changes[n] == "Q2")
+        {
+            kPsi->set_Q2(0.7);
+            kDstar->set_Q2(0.7);
+        }
+        if (changes[n] == "debug mode")
+        {
+            debug = 1;
+            dstar_lambdac->set_debug(debug);
+        }
+
+        std::string label = (changes[n] == "") ? "" : " after changing " + changes[n];
+        pass &= compare_sum("pomeron + P_c" + label, psi_sum, make_psi_sum, s_psi, t_psi);
+        pass &= compare_sum("D* + Lambda_c" + label, dstar_sum, make_dstar_sum, s, t);
+    }
+
+    // A background shared by three sums is only evaluated once per point
+    reaction_kinematics * kX = new reaction_kinematics(M_X3872);
+    kX->set_JP(1, 1);
+
+    counting_exchange * bkg = new counting_exchange(kX, M_RHO);
+    counting_exchange * a   = new counting_exchange(kX, M_OMEGA);
+    counting_exchange * b   = new counting_exchange(kX, M_JPSI);
+    bkg->set_params({3.6E-3, 2.4, 14.6});
+    a->set_params({8.2E-3, 16., 0.});
+    b->set_params({5.E-3, 1., 0.});
+
+    amplitude_sum * A = new amplitude_sum(kX, std::vector<amplitude*>{bkg, a});
+    amplitude_sum * B = new amplitude_sum(kX, std::vector<amplitude*>{bkg, b});
+    amplitude_sum * C = new amplitude_sum(kX, std::vector<amplitude*>{bkg});
+
+    comparison counts("evaluations of each term", 0.);
+    auto evaluate_all = [&]()
+    {
+        A->differential_xsection(s, t);
+        B->differential_xsection(s, t);
+        C->differential_xsection(s, t);
+    };
+    auto check_counts = [&](int n_bkg, int n_a, int n_b)
+    {
+        counts.add(bkg->_evaluations, n_bkg);
+        counts.add(a->_evaluations, n_a);
+        counts.add(b->_evaluations, n_b);
+    };
+
+    evaluate_all();
+    check_counts(1, 1, 1);
+
+    // Nothing changed
+    evaluate_all();
+    check_counts(1, 1, 1);
+
+    // Only the edited term
+    a->set_params({1.E-2, 16., 0.});
+    evaluate_all();
+    check_counts(1, 2, 1);
+
+    // Everything depends on Q2
+    kX->set_Q2(0.3);
+    evaluate_all();
+    check_counts(2, 3, 2);
+
+    // A new point
+    A->differential_xsection(s, -0.5);
+    check_counts(3, 4, 2);
+
+    pass &= counts.report();
+
+    // Terms with kinematics of their own, here with more helicities than the sum and in a different order,
+    // against the sum of the helicity amplitudes of each term
+    reaction_kinematics * kP = new reaction_kinematics(M_D, M_LAMBDAC, M_PROTON);
+    reaction_kinematics * kV = new reaction_kinematics(M_D, M_LAMBDAC, M_PROTON);
+    kP->set_JP(0, -1);
+    kV->set_JP(1, -1);
+
+    vector_exchange * dstarP = new vector_exchange(kP, M_DSTAR, "D*");
+    vector_exchange * dstarV = new vector_exchange(kV, M_DSTAR, "D*");
+    dstarP->set_params({0.134, -13.2, 0.5});
+    dstarV->set_params({0.641, -13.2, 0.3});
+    amplitude_sum * mixed = new amplitude_sum(kP, {dstarP, dstarV}, "sum");
+
+    comparison point("terms with own kinematics, at a point", 1.E-13);
+    comparison grid("terms with own kinematics, on a grid of t", 1.E-13);
+    for (int i = 0; i < TEST_W.size(); i++)
+    {
+        double s = TEST_W[i] * TEST_W[i];
+        if (sqrt(s) < kP->Wth() + 0.1) continue;
+
+        std::vector<double> t;
+        for (int j = 0; j < TEST_THETA.size(); j++) t.push_back(kP->t_man(s, TEST_THETA[j]));
+
+        std::vector<std::vector<std::complex<double>>> on_grid;
+        mixed->helicity_amplitudes(s, t, on_grid);
+
+        for (int j = 0; j < t.size(); j++)
+        {
+            std::vector<std::complex<double>> at_point, reference;
+            mixed->helicity_amplitudes(s, t[j], at_point);
+            for (int k = 0; k < kP->_nAmps; k++)
+            {
+                std::array<int, 4> hel = kP->_helicities[k];
+                reference.push_back(dstarP->helicity_amplitude(hel, s, t[j]) + dstarV->helicity_amplitude(hel, s, t[j]));
+            }
+
+            double scale = max_modulus(reference);
+            for (int k = 0; k < reference.size(); k++)
+            {
+                point.add(at_point[k], reference[k], scale);
+                grid.add(on_grid[j][k], reference[k], scale);
+            }
+        }
+    }
+    pass &= point.report();
+    pass &= grid.report();
+
+    delete mixed; delete dstarP; delete dstarV;
+    delete kP; delete kV;
+
+    return (pass) ? 0 : 1;
+};
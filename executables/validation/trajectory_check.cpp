@@ -0,0 +1,108 @@
+// ---------------------------------------------------------------------------
+// Compare a dispersive_trajectory with Im alpha = gamma sqrt(s - s_th) against
+// the equivalent sqrt_trajectory above and below threshold, and the batched
+// evaluation of every trajectory against point-by-point evaluation.
+//
+// USAGE:
+// make trajectory_check && ./trajectory_check
+//
+// OUTPUT:
+// Largest relative deviation for each check
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "regge_trajectory.hpp"
+
+using namespace jpacPhoto;
+
+// Trajectory which only implements the single-point evaluation
+// to test the default grid evaluation of the base class
+class quadratic_trajectory : public regge_trajectory
+{
+    public:
+    quadratic_trajectory(int sig, double a0, double a1, double a2)
+    : regge_trajectory(sig), _a0(a0), _a1(a1), _a2(a2)
+    {};
+
+    std::complex<double> eval(double s){ return _a0 + _a1 * s + _a2 * s * s; };
+    std::complex<double> slope(double s = 0.){ return _a1 + 2. * _a2 * s; };
+
+    private:
+    double _a0, _a1, _a2;
+};
+
+// Compare the grid overloads with single calls at each point
+void compare_batched(regge_trajectory * alpha, const std::vector<double> & s, comparison & c)
+{
+    std::vector<std::complex<double>> eval, slope;
+    alpha->eval(s, eval);
+    alpha->slope(s, slope);
+
+    for (int i = 0; i < s.size(); i++)
+    {
+        c.add(eval[i], alpha->eval(s[i]), 1.);
+        c.add(slope[i], alpha->slope(s[i]), 1.);
+    }
+};
+
+int main( int argc, char** argv )
+{
+    double a0 = 0.5, gamma = 0.9, sth = 0.078;
+
+    sqrt_trajectory square_root(+1, a0, gamma, sth);
+    dispersive_trajectory dispersive(+1, a0, 0., sth, [=](double x){ return (x > sth) ? gamma * sqrt(x - sth) : 0.; });
+
+    // Below, near and above threshold avoiding the branch point itself
+    std::vector<double> s;
+    for (double x = -3.; x < 2.; x += 0.137) s.push_back(x);
+
+    // The dispersive integral is accurate to about 1.E-8 so the subtracted trajectory is accurate to 1.E-8 |s|.
+    // Above threshold the slope is a finite difference which loses accuracy close to the branch point
+    comparison eval("dispersive vs sqrt trajectory, alpha(s)", 1.E-8);
+    comparison slope("dispersive vs sqrt trajectory, alpha'(s)", 1.E-8);
+    comparison slope_threshold("dispersive vs sqrt trajectory, alpha'(s) near s_th", 1.E-6);
+    for (int i = 0; i < s.size(); i++)
+    {
+        eval.add(dispersive.eval(s[i]), square_root.eval(s[i]), std::max(1., std::abs(s[i])));
+
+        bool near_threshold = (s[i] > sth && s[i] < sth + 0.5);
+        comparison & c = (near_threshold) ? slope_threshold : slope;
+        c.add(dispersive.slope(s[i]), square_root.slope(s[i]), 1.);
+    }
+
+    linear_trajectory linear(-1, 0.5, 0.9);
+    quadratic_trajectory quadratic(+1, 0.4, 0.8, -0.05);
+
+    comparison linear_batch("batched vs single, linear_trajectory", 1.E-15);
+    comparison sqrt_batch("batched vs single, sqrt_trajectory", 1.E-15);
+    comparison dispersive_batch("batched vs single, dispersive_trajectory", 1.E-12);
+    comparison default_batch("batched vs single, base class default", 1.E-15);
+
+    compare_batched(&linear, s, linear_batch);
+    compare_batched(&square_root, s, sqrt_batch);
+    compare_batched(&dispersive, s, dispersive_batch);
+    compare_batched(&quadratic, s, default_batch);
+
+    // Single points off the saved grid of the dispersive trajectory must still be evaluated
+    comparison off_grid("dispersive vs sqrt trajectory off the saved grid", 1.E-8);
+    for (int i = 0; i < s.size(); i++)
+    {
+        off_grid.add(dispersive.eval(s[i] + 0.01), square_root.eval(s[i] + 0.01), std::max(1., std::abs(s[i])));
+    }
+
+    bool pass = true;
+    pass &= eval.report();
+    pass &= slope.report();
+    pass &= slope_threshold.report();
+    pass &= linear_batch.report();
+    pass &= sqrt_batch.report();
+    pass &= dispersive_batch.report();
+    pass &= default_batch.report();
+    pass &= off_grid.report();
+
+    return (pass) ? 0 : 1;
+};
@@ -0,0 +1,288 @@
+// ---------------------------------------------------------------------------
+// Utilities shared by the validation drivers, which evaluate the same quantities
+// in two different ways (e.g. closed-form vs numeric, cached vs fresh)
+// and report the largest deviation found between them.
+//
+// Each driver prints one line per comparison and returns a non-zero exit code
+// if any of them exceeds its tolerance.
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#ifndef _VALIDATION_
+#define _VALIDATION_
+
+#include "constants.hpp"
+#include "reaction_kinematics.hpp"
+#include "regge_trajectory.hpp"
+#include "amplitudes/pomeron_exchange.hpp"
+#include "amplitudes/vector_exchange.hpp"
+#include "amplitudes/pseudoscalar_exchange.hpp"
+#include "amplitudes/dirac_exchange.hpp"
+#include "amplitudes/rarita_exchange.hpp"
+#include "amplitudes/baryon_resonance.hpp"
+#include "amplitudes/amplitude_sum.hpp"
+
+#include <cmath>
+#include <array>
+#include <complex>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace jpacPhoto
+{
+    // ---------------------------------------------------------------------------
+    // Largest deviation between pairs of values relative to the larger of the two,
+    // or to a given scale (e.g. the largest helicity amplitude at the same point)
+    // so that amplitudes which vanish by symmetry do not dominate
+    class comparison
+    {
+        public:
+        comparison(std::string label, double tolerance)
+        : _label(label), _tolerance(tolerance)
+        {};
+
+        inline void add(std::complex<double> x, std::complex<double> y, double scale = 0.)
+        {
+            double norm = std::max(scale, std::max(std::abs(x), std::abs(y)));
+            double dev  = (norm > 0.) ? std::abs(x - y) / norm : 0.;
+
+            if (std::isnan(dev) || dev > _maxDev) _maxDev = dev;
+            _n++;
+        };
+
+        // Print the result and return whether every deviation was within tolerance
+        inline bool report()
+        {
+            bool pass = (_n > 0 && _maxDev <= _tolerance);
+
+            std::cout << std::left  << std::setw(55) << _label;
+            std::cout << std::right << std::setw(8)  << _n;
+            std::cout << std::scientific << std::setprecision(2) << std::setw(12) << _maxDev;
+            std::cout << "  (tol " << _tolerance << ")  " << ((pass) ? "PASS" : "FAIL") << std::endl;
+
+            return pass;
+        };
+
+        private:
+        std::string _label;
+        double _tolerance;
+        double _maxDev = 0.;
+        int _n = 0;
+    };
+
+    // ---------------------------------------------------------------------------
+    // One instance of every amplitude in the library with representative parameters.
+    // Each instance builds new objects (including the kinematics) so two sets can be configured
+    // or evaluated independently of each other. Everything is deleted with the set.
+    struct test_amplitude
+    {
+        std::string name;
+        amplitude * amp;
+    };
+
+    class test_amplitudes
+    {
+        public:
+        test_amplitudes()
+        {
+            // Pomeron exchange, all three models
+            reaction_kinematics * kPsi = own(new reaction_kinematics(M_JPSI));
+            kPsi->set_JP(1, -1);
+            linear_trajectory * alphaP = own(new linear_trajectory(+1, 0.941, 0.364));
+            for (int m = 0; m < 3; m++)
+            {
+                pomeron_exchange * pom = own(new pomeron_exchange(kPsi, alphaP, m, "pomeron"));
+                pom->set_params({0.379, 0.12});
+                _amps.push_back({"pomeron_" + std::to_string(m), pom});
+            }
+
+            // Vector exchange for axial-vector production, fixed-spin and reggeized
+            reaction_kinematics * kX = own(new reaction_kinematics(M_X3872));
+            kX->set_JP(1, 1);
+            vector_exchange * rho = own(new vector_exchange(kX, M_RHO, "rho"));
+            rho->set_params({3.6E-3, 2.4, 14.6});
+            _amps.push_back({"vector_axial", rho});
+
+            vector_exchange * rhoCov = own(new vector_exchange(kX, M_RHO, "rho"));
+            rhoCov->set_params({3.6E-3, 2.4, 14.6});
+            rhoCov->set_formfactor(1, 1.4);
+            rhoCov->force_covariant(true);
+            _amps.push_back({"vector_axial_covariant", rhoCov});
+
+            linear_trajectory * alphaRho = own(new linear_trajectory(-1, 0.5, 0.9));
+            vector_exchange * rhoR = own(new vector_exchange(kX, alphaRho, "rho"));
+            rhoR->set_params({3.6E-3, 2.4, 14.6});
+            _amps.push_back({"vector_axial_regge", rhoR});
+
+            // Vector exchange for pseudoscalar, vector, and scalar production
+            reaction_kinematics * kD = own(new reaction_kinematics(M_D, M_LAMBDAC, M_PROTON));
+            kD->set_JP(0, -1);
+            vector_exchange * dstarP = own(new vector_exchange(kD, M_DSTAR, "D*"));
+            dstarP->set_params({0.134, -13.2, 0.5});
+            dstarP->set_formfactor(2, M_DSTAR + 0.25);
+            _amps.push_back({"vector_pseudoscalar", dstarP});
+
+            reaction_kinematics * kDstar = own(new reaction_kinematics(M_DSTAR, M_LAMBDAC, M_PROTON));
+            kDstar->set_JP(1, -1);
+            vector_exchange * dstarV = own(new vector_exchange(kDstar, M_DSTAR, "D*"));
+            dstarV->set_params({0.641, -13.2, 0.3});
+            _amps.push_back({"vector_vector", dstarV});
+
+            reaction_kinematics * kS = own(new reaction_kinematics(M_CHIC1 - 0.1));
+            kS->set_JP(0, 1);
+            vector_exchange * omegaS = own(new vector_exchange(kS, M_OMEGA, "omega"));
+            omegaS->set_params({0.1, 2., 1.});
+            _amps.push_back({"vector_scalar", omegaS});
+
+            // and reggeized, with residues from the Feynman rules vertices
+            linear_trajectory * alphaOmega = own(new linear_trajectory(-1, 0.45, 0.9));
+            vector_exchange * omegaSR = own(new vector_exchange(kS, alphaOmega, "omega"));
+            omegaSR->set_params({0.1, 2., 1.});
+            _amps.push_back({"vector_scalar_regge", omegaSR});
+
+            // Pseudoscalar exchange, fixed-spin and reggeized
+            reaction_kinematics * kZ = own(new reaction_kinematics(M_ZC3900));
+            kZ->set_JP(1, 1);
+            pseudoscalar_exchange * pi = own(new pseudoscalar_exchange(kZ, M_PION, "pi"));
+            pi->set_params({0.01, sqrt(4. * PI * 13.81)});
+            _amps.push_back({"pseudoscalar_axial", pi});
+
+            pseudoscalar_exchange * piCov = own(new pseudoscalar_exchange(kZ, M_PION, "pi"));
+            piCov->set_params({0.01, sqrt(4. * PI * 13.81)});
+            piCov->force_covariant(true);
+            _amps.push_back({"pseudoscalar_axial_covariant", piCov});
+
+            linear_trajectory * alphaPi = own(new linear_trajectory(+1, -0.7 * M2_PION, 0.7));
+            pseudoscalar_exchange * piR = own(new pseudoscalar_exchange(kZ, alphaPi, "pi"));
+            piR->set_params({0.01, sqrt(4. * PI * 13.81)});
+            piR->set_formfactor(true, 1. / 0.81);
+            _amps.push_back({"pseudoscalar_axial_regge", piR});
+
+            pseudoscalar_exchange * dV = own(new pseudoscalar_exchange(kDstar, M_D, "D"));
+            dV->set_params({0.134, -4.3});
+            _amps.push_back({"pseudoscalar_vector", dV});
+
+            linear_trajectory * alphaD = own(new linear_trajectory(+1, -0.7 * M_D * M_D, 0.7));
+            pseudoscalar_exchange * dVR = own(new pseudoscalar_exchange(kDstar, alphaD, "D"));
+            dVR->set_params({0.134, -4.3});
+            _amps.push_back({"pseudoscalar_vector_regge", dVR});
+
+            // Spin-1/2 and spin-3/2 exchanges in the u-channel
+            dirac_exchange * lamcP = own(new dirac_exchange(kD, M_LAMBDAC, "Lambda_c"));
+            lamcP->set_params({sqrt(4. * PI * ALPHA), -4.3});
+            lamcP->set_formfactor(2, M_LAMBDAC + 0.25);
+            _amps.push_back({"dirac_pseudoscalar", lamcP});
+
+            dirac_exchange * lamcV = own(new dirac_exchange(kDstar, M_LAMBDAC, "Lambda_c"));
+            lamcV->set_params({sqrt(4. * PI * ALPHA), -13.2});
+            _amps.push_back({"dirac_vector", lamcV});
+
+            rarita_exchange * sigc = own(new rarita_exchange(kDstar, 2.5, "Sigma_c"));
+            sigc->set_params({0.3, -2.});
+            _amps.push_back({"rarita_vector", sigc});
+
+            // s-channel baryon resonances with spin 1/2, 3/2, 5/2 and both parities
+            std::vector<amplitude*> pentaquarks;
+            for (int j = 1; j <= 5; j += 2)
+            {
+                for (int p = 1; p >= -1; p -= 2)
+                {
+                    baryon_resonance * pc = own(new baryon_resonance(kPsi, j, p, 4.45, 0.02, "P_c"));
+                    pc->set_params({0.01, 0.7071});
+                    _amps.push_back({"resonance_" + std::to_string(j) + "/2" + ((p > 0) ? "+" : "-"), pc});
+                    pentaquarks.push_back(pc);
+                }
+            }
+
+            // and a sum of the pomeron with two of them
+            amplitude_sum * sum = own(new amplitude_sum(kPsi, {_amps[0].amp, pentaquarks[0], pentaquarks[1]}, "sum"));
+            _amps.push_back({"sum", sum});
+        };
+
+        ~test_amplitudes()
+        {
+            // In reverse so amplitudes go before the kinematics and trajectories they point to
+            for (int i = _deleters.size() - 1; i >= 0; i--) _deleters[i]();
+        };
+
+        // Owns everything it allocates so it cannot be copied
+        test_amplitudes(const test_amplitudes &) = delete;
+        test_amplitudes & operator=(const test_amplitudes &) = delete;
+
+        inline int size(){ return _amps.size(); };
+        inline test_amplitude & operator[](int i){ return _amps[i]; };
+
+        private:
+        std::vector<test_amplitude> _amps;
+        std::vector<std::function<void()>> _deleters;
+
+        // Deleted through its own type
+        template<class T>
+        inline T * own(T * x)
+        {
+            _deleters.push_back([x]() -> void { delete x; });
+            return x;
+        };
+    };
+
+    // Energies and s-channel angles at which amplitudes are compared
+    // energies below the threshold of an amplitude are skipped
+    const std::vector<double> TEST_W     = {4.3, 4.6, 7., 20.};
+    const std::vector<double> TEST_THETA = {0.05, 0.6, 1.7, 2.9};
+
+    inline double max_modulus(const std::vector<std::complex<double>> & x)
+    {
+        double result = 0.;
+        for (int i = 0; i < x.size(); i++) result = std::max(result, std::abs(x[i]));
+        return result;
+    };
+
+    // ---------------------------------------------------------------------------
+    // Compare an amplitude which saves pieces between evaluations with a new amplitude at every point.
+    // Points are scanned in s at fixed t, forwards and then backwards so the second pass can reuse
+    // everything saved in the first. The scan ends where it starts so a following call begins at the
+    // last point saved, which catches anything not recalculated after a change made in between.
+    inline void compare_with_new(amplitude * cached, std::function<amplitude*()> make_fresh, comparison & c)
+    {
+        reaction_kinematics * kinem = cached->_kinematics;
+
+        std::vector<std::array<double, 2>> points;
+        for (double t = -0.1; t > -3.; t -= 0.35)
+        {
+            for (double W = 5.; W <= 20.; W += 1.5)
+            {
+                double s = W * W;
+                if (t > kinem->t_man(s, 0.) || t < kinem->t_man(s, PI)) continue;
+                points.push_back({{s, t}});
+            }
+        }
+
+        for (int n = 0; n < 2 * points.size(); n++)
+        {
+            int m = (n < points.size()) ? n : 2 * points.size() - 1 - n;
+            double s = points[m][0], t = points[m][1];
+
+            amplitude * fresh = make_fresh();
+
+            std::vector<std::complex<double>> x, y;
+            for (int i = 0; i < kinem->_nAmps; i++)
+            {
+                x.push_back(cached->helicity_amplitude(kinem->_helicities[i], s, t));
+                y.push_back(fresh->helicity_amplitude(kinem->_helicities[i], s, t));
+            }
+
+            double scale = std::max(max_modulus(x), max_modulus(y));
+            for (int i = 0; i < x.size(); i++) c.add(x[i], y[i], scale);
+
+            delete fresh;
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,134 @@
+// ---------------------------------------------------------------------------
+// Check the general-spin Wigner d-functions against Wigner's explicit sum formula
+// and hand-coded low spin elements, test the unitarity of the full matrices,
+// and compare the single-element, batched, and complex cosine evaluations.
+//
+// USAGE:
+// make wigner_check && ./wigner_check
+//
+// OUTPUT:
+// Largest absolute deviation for each check
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "misc_math.hpp"
+
+#include <chrono>
+
+using namespace jpacPhoto;
+
+// d^j_{m1 m2}(theta) from Wigner's formula with all arguments passed as twice their value
+double wigner_sum(int j, int m1, int m2, double theta)
+{
+    int jp1 = (j + m1) / 2, jm1 = (j - m1) / 2, jp2 = (j + m2) / 2, jm2 = (j - m2) / 2;
+    double prefactor = sqrt(std::tgamma(jp1 + 1) * std::tgamma(jm1 + 1) * std::tgamma(jp2 + 1) * std::tgamma(jm2 + 1));
+
+    double result = 0.;
+    for (int k = std::max(0, (m2 - m1) / 2); k <= std::min(jp2, jm1); k++)
+    {
+        double term = prefactor;
+        term /= std::tgamma(jp2 - k + 1) * std::tgamma(k + 1) * std::tgamma((m1 - m2) / 2 + k + 1) * std::tgamma(jm1 - k + 1);
+        term *= pow(cos(theta / 2.), jp2 + jm1 - 2 * k) * pow(sin(theta / 2.), (m1 - m2) / 2 + 2 * k);
+        if (((m1 - m2) / 2 + k) % 2 != 0) term *= -1.;
+
+        result += term;
+    }
+
+    return result;
+};
+
+int main( int argc, char** argv )
+{
+    int JMAX = 12; // 2 * j
+    std::vector<double> thetas = {0., 0.05, 0.3, 1.1, 1.6, 2.5, 3.1, PI};
+
+    comparison formula("wigner_d vs Wigner's formula, j <= 6", 1.E-12);
+    comparison low_spin("wigner_d vs explicit j = 1/2, 1, 3/2", 1.E-14);
+    comparison unitarity("d^j d^j^T = 1, j <= 6", 1.E-13);
+    comparison consistency("matrix, batched, single and cos versions", 1.E-14);
+
+    for (int j = 0; j <= JMAX; j++)
+    {
+        wigner_d_matrix d(j);
+
+        std::vector<double> batch;
+        d.evaluate(thetas, batch);
+
+        for (int n = 0; n < thetas.size(); n++)
+        {
+            d.update(thetas[n]);
+
+            for (int a = 0; a <= j; a++)
+            {
+                for (int b = 0; b <= j; b++)
+                {
+                    int lam1 = j - 2 * a, lam2 = j - 2 * b;
+
+                    formula.add(d(lam1, lam2), wigner_sum(j, lam1, lam2, thetas[n]), 1.);
+
+                    consistency.add(batch[(a * (j + 1) + b) * thetas.size() + n], d(lam1, lam2), 1.);
+                    consistency.add(wigner_d(j, lam1, lam2, thetas[n]), d(lam1, lam2), 1.);
+                    consistency.add(wigner_d_cos(j, lam1, lam2, cos(thetas[n])), d(lam1, lam2), 1.);
+
+                    double row = 0.;
+                    for (int c = 0; c <= j; c++) row += d(lam1, j - 2 * c) * d(lam2, j - 2 * c);
+                    unitarity.add(row, (a == b) ? 1. : 0., 1.);
+                }
+            }
+
+            // Explicit low spin elements
+            double x = thetas[n], c = cos(x / 2.), s = sin(x / 2.);
+
+            low_spin.add(wigner_d(1, 1, 1, x), c, 1.);
+            low_spin.add(wigner_d(1, 1, -1, x), -s, 1.);
+            low_spin.add(wigner_d(1, -1, 1, x), s, 1.);
+
+            low_spin.add(wigner_d(2, 2, 2, x), (1. + cos(x)) / 2., 1.);
+            low_spin.add(wigner_d(2, 2, 0, x), -sin(x) / sqrt(2.), 1.);
+            low_spin.add(wigner_d(2, 2, -2, x), (1. - cos(x)) / 2., 1.);
+            low_spin.add(wigner_d(2, 0, 0, x), cos(x), 1.);
+
+            low_spin.add(wigner_d(3, 3, 3, x), c * c * c, 1.);
+            low_spin.add(wigner_d(3, 3, 1, x), -sqrt(3.) * c * c * s, 1.);
+            low_spin.add(wigner_d(3, 3, -1, x), sqrt(3.) * c * s * s, 1.);
+            low_spin.add(wigner_d(3, 3, -3, x), -s * s * s, 1.);
+            low_spin.add(wigner_d(3, 1, 1, x), c * (3. * c * c - 2.), 1.);
+            low_spin.add(wigner_d(3, 1, -1, x), s * (3. * s * s - 2.), 1.);
+        }
+    }
+
+    bool pass = true;
+    pass &= formula.report();
+    pass &= low_spin.report();
+    pass &= unitarity.report();
+    pass &= consistency.report();
+
+    // Single elements at a new angle every call, against the explicit d^{3/2}_{3/2 1/2} and the whole matrix
+    std::vector<double> z;
+    for (int i = 0; i < 1000000; i++) z.push_back(PI * double(i) / 1000000.);
+
+    wigner_d_matrix d(3);
+    double sum = 0.;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < z.size(); i++) sum += wigner_d(3, 3, 1, z[i]);
+    auto first = std::chrono::steady_clock::now();
+    for (int i = 0; i < z.size(); i++) sum += - sqrt(3.) * cos(z[i] / 2.) * cos(z[i] / 2.) * sin(z[i] / 2.);
+    auto second = std::chrono::steady_clock::now();
+    for (int i = 0; i < z.size(); i++) { d.update(z[i]); sum += d(3, 1); }
+    auto stop = std::chrono::steady_clock::now();
+
+    double t_single   = std::chrono::duration<double, std::nano>(first - start).count() / z.size();
+    double t_explicit = std::chrono::duration<double, std::nano>(second - first).count() / z.size();
+    double t_matrix   = std::chrono::duration<double, std::nano>(stop - second).count() / z.size();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "wigner_d: " << t_single << " ns, explicit: " << t_explicit << " ns, ";
+    std::cout << "wigner_d_matrix: " << t_matrix << " ns per evaluation (checksum " << sum << ")" << std::endl;
+
+    return (pass) ? 0 : 1;
+};
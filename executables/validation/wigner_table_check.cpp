@@ -0,0 +1,115 @@
+// ---------------------------------------------------------------------------
+// Compare interpolated Wigner d-function tables with the exact d-functions
+// for several spins and tolerances, compare every amplitude evaluated with
+// and without tables, and time a table lookup against exact evaluation.
+//
+// USAGE:
+// make wigner_table_check && ./wigner_table_check
+//
+// OUTPUT:
+// Largest absolute deviation for each table and amplitude, and evaluation times
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "validation.hpp"
+#include "misc_math.hpp"
+
+#include <chrono>
+#include <random>
+#include <sstream>
+
+using namespace jpacPhoto;
+
+int main( int argc, char** argv )
+{
+    bool pass = true;
+
+    std::mt19937 generator(2020);
+    std::uniform_real_distribution<double> uniform(-1., 1.);
+
+    // Every element of each table at random z and the end points
+    // should be within the requested tolerance of the exact result
+    std::vector<double> tolerances = {1.E-6, 1.E-10};
+    for (int j = 1; j <= 13; j++)
+    {
+        for (int i = 0; i < tolerances.size(); i++)
+        {
+            wigner_d_table table(j, tolerances[i], 100000000);
+
+            std::stringstream label;
+            label << "table j = " << j << "/2, tolerance " << tolerances[i] << ", " << table.get_nodes() << " nodes";
+            comparison c(label.str(), std::max(tolerances[i], 1.E-14));
+
+            for (int n = 0; n < 2000; n++)
+            {
+                double z = (n == 0) ? -1. : ((n == 1) ? 1. : uniform(generator));
+
+                for (int lam1 = -j; lam1 <= j; lam1 += 2)
+                {
+                    for (int lam2 = -j; lam2 <= j; lam2 += 2)
+                    {
+                        c.add(table(lam1, lam2, z), wigner_d(j, lam1, lam2, acos(z)), 1.);
+                    }
+                }
+            }
+
+            pass &= c.report();
+        }
+    }
+
+    // Amplitudes with tables at tolerance 1.E-10
+    test_amplitudes exact;
+    test_amplitudes tabulated;
+    for (int n = 0; n < tabulated.size(); n++) tabulated[n].amp->use_wigner_tables(true, 1.E-10, 100000000);
+
+    for (int n = 0; n < exact.size(); n++)
+    {
+        amplitude * a = exact[n].amp, * b = tabulated[n].amp;
+        comparison c(exact[n].name + " with tables", 1.E-9);
+
+        for (int i = 0; i < TEST_W.size(); i++)
+        {
+            if (TEST_W[i] < a->_kinematics->Wth() + 0.01) continue;
+            double s = TEST_W[i] * TEST_W[i];
+
+            for (int j = 0; j < TEST_THETA.size(); j++)
+            {
+                double t = a->_kinematics->t_man(s, TEST_THETA[j]);
+
+                std::vector<std::complex<double>> x, y;
+                a->helicity_amplitudes(s, t, x);
+                b->helicity_amplitudes(s, t, y);
+
+                double scale = std::max(max_modulus(x), max_modulus(y));
+                for (int k = 0; k < x.size(); k++) c.add(x[k], y[k], scale);
+            }
+        }
+
+        pass &= c.report();
+    }
+
+    // Timing of d^{3/2}_{1/2 3/2} at random z
+    std::vector<double> z(1000000);
+    for (int i = 0; i < z.size(); i++) z[i] = uniform(generator);
+
+    wigner_d_table table(3);
+    double sum = 0.;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < z.size(); i++) sum += table(1, 3, z[i]);
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < z.size(); i++) sum += wigner_d_half(3, 1, 3, acos(z[i]));
+    auto stop = std::chrono::steady_clock::now();
+
+    double t_table = std::chrono::duration<double, std::nano>(middle - start).count() / z.size();
+    double t_exact = std::chrono::duration<double, std::nano>(stop - middle).count() / z.size();
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "table: " << t_table << " ns, wigner_d_half: " << t_exact << " ns per evaluation";
+    std::cout << " (checksum " << sum << ")" << std::endl;
+
+    return (pass) ? 0 : 1;
+};
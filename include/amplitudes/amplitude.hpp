@@ -27,9 +27,43 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
+#include <unordered_map>
 
 namespace jpacPhoto
 {
+    // ---------------------------------------------------------------------------
+    // Storage for pieces of an amplitude which only depend on t (e.g. factors of a Regge propagator)
+    // so that scans in s at fixed t, or grids in s and t, only calculate them once per value of t.
+    // Entries are saved by the value of t and the caller is responsible for checking
+    // that a found entry is still valid (e.g. masses or trajectory have not changed).
+    template<class T>
+    class t_cache
+    {
+        public:
+
+        // Pointer to the saved entry at t or NULL if there is none
+        inline T * find(double t)
+        {
+            typename std::unordered_map<double, T>::iterator entry = _entries.find(t);
+            return (entry == _entries.end()) ? NULL : &(entry->second);
+        };
+
+        // Save a new entry, starting over if too many different t have been stored
+        inline T & insert(double t, const T & x)
+        {
+            if (_entries.size() >= _max_entries) _entries.clear();
+            return (_entries[t] = x);
+        };
+
+        inline void clear(){ _entries.clear(); };
+
+        private:
+
+        static const int _max_entries = 10000;
+        std::unordered_map<double, T> _entries;
+    };
+
     class amplitude
     {
         public:
@@ -38,6 +72,9 @@ namespace jpacPhoto
         : _kinematics(xkinem), _identifier(id)
         {};
 
+        // Derived amplitudes own tables, caches, etc. so they must be deletable through a base pointer
+        virtual ~amplitude() {};
+
         // Kinematics object for thresholds and etc.
         reaction_kinematics * _kinematics;
 
@@ -51,6 +88,13 @@ namespace jpacPhoto
         // Must be given a specific implementation in a user derived class
         virtual std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t) = 0;
 
+        // All helicity amplitudes at once, in the order of _kinematics->_helicities.
+        // By default these just call helicity_amplitude() for each combination
+        // but amplitudes may override them to calculate helicity-independent pieces only once
+        // or, with a vector of t, once for a whole grid of momentum transfers.
+        virtual void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+        virtual void helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result);
+
         // ---------------------------------------------------------------------------
         // Observables
         // Evaluatable in terms of s and t or an event object (see reaction_kinematics.hpp)
@@ -60,6 +104,7 @@ namespace jpacPhoto
 
         // Differential and total cross-section
         double differential_xsection(double s, double t);
+        std::vector<double> differential_xsection(double s, const std::vector<double> & t);
 
         // integrated crossection
         double integrated_xsection(double s);
@@ -79,19 +124,54 @@ namespace jpacPhoto
         double parity_asymmetry(double s, double t);
 
         // ---------------------------------------------------------------------------
-        // If helicity amplitudes have already been generated for a value of mV, s, t 
-        // store them
-        double _cached_mX2 = 0., _cached_s = 0., _cached_t = 0.;
+        // If helicity amplitudes have already been generated for a value of mV, Q2, s, t 
+        // and the same parameters, store them
+        double _cached_mX2 = 0., _cached_mB2 = 0., _cached_s = 0., _cached_t = 0.;
+        int _cached_version = -1;
         std::vector<std::complex<double>> _cached_helicity_amplitude;
 
         void check_cache(double s, double t);
 
+        // Counts changes of the parameters so cached amplitudes, here or in any amplitude_sum
+        // containing this amplitude, are recalculated when they are out of date.
+        // Setters which change the amplitude other than set_params() should call params_changed()
+        int _paramsVersion = 0;
+        inline void params_changed(){ _paramsVersion++; };
+        virtual int params_version(){ return _paramsVersion; };
+
+        // ---------------------------------------------------------------------------
+        // Wigner d-functions in terms of the cosine of the scattering angle
+        // j, lam1, lam2 passed as 2 * j, 2 * lambda, 2 * lambda^prime
+        //
+        // These are evaluated exactly unless interpolation tables are switched on,
+        // which trades a bounded loss of accuracy (tolerance) for speed when weighting many events.
+        // Tables are built once per spin when first needed and use at most budget bytes each.
+        // Arguments outside the physical region, e.g. t-channel cosines, are always evaluated exactly.
+        // Amplitudes saving d-functions override this to also clear them
+        virtual void use_wigner_tables(bool ifuse, double tolerance = 1.E-8, int budget = 1000000)
+        {
+            _useWignerTables = ifuse;
+            _wignerTolerance = tolerance; _wignerBudget = budget;
+            _wignerTables.clear();
+            params_changed();
+        };
+
+        std::complex<double> d_function(int j, int lam1, int lam2, std::complex<double> z);
+
+        bool _useWignerTables = false;
+        double _wignerTolerance = 1.E-8;
+        int _wignerBudget = 1000000;
+        std::map<int, wigner_d_table> _wignerTables;
+
         // ---------------------------------------------------------------------------
         // nParams error message
         int _nParams = 0;
         inline void set_nParams(int N){ _nParams = N; };
         inline void check_nParams(std::vector<double> params)
         {
+            // Every set_params() starts here so this also marks cached amplitudes as out of date
+            params_changed();
+
             if (params.size() != _nParams)
             {
                 std::cout << "\nWarning! Invalid number of parameters (" << params.size() << ") passed to " << _identifier << ".\n";
@@ -39,6 +39,7 @@ namespace jpacPhoto
     void add_amplitude(amplitude * new_amp)
     {
       _amps.push_back(new_amp);
+      params_changed();
     };
 
     // Add all the members of an existing sum to a new sum
@@ -48,6 +49,7 @@ namespace jpacPhoto
       {
         _amps.push_back(new_sum->_amps[i]);
       }
+      params_changed();
     };
 
     // empty allowedJP, leave the checks to the individual amps instead
@@ -59,8 +61,27 @@ namespace jpacPhoto
     // TODO: Add a set_params which timesi in one vector and allocates approriaten number of
     // params to each sub amplitude
 
+    // The sum is out of date whenever any of its amplitudes are
+    inline int params_version()
+    {
+      int version = _paramsVersion;
+      for (int i = 0; i < _amps.size(); i++) version += _amps[i]->params_version();
+      return version;
+    };
+
     // Evaluate the sum for given set of helicites, energy, and cos
     std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t);
+
+    // or all helicities at once, adding up the cached helicity amplitudes of each term
+    // so amplitudes shared between different sums are only calculated once per point
+    void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+
+    // and on a grid of t, with each amplitude using its own evaluation for the whole grid
+    void helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result);
+
+  private:
+    // Amplitude of the i-th term for given helicities, from its cached amplitudes when it has them
+    std::complex<double> term_amplitude(int i, std::array<int, 4> helicities, double s, double t);
   };
 };
 
@@ -67,11 +67,33 @@ namespace jpacPhoto
             check_nParams(params);
             _xBR = params[0];
             _photoR = params[1];
+            update_couplings();
         };
 
         // Combined total amplitude including Breit Wigner pole
         std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t);
 
+        // All helicities at once, couplings and d-functions are shared between helicities
+        void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+
+        // Lineshape scan: all helicity amplitudes on a grid of s at fixed CoM scattering angle theta,
+        // where the d-functions are only calculated once for the whole grid
+        void lineshape(const std::vector<double> & s, double theta, std::vector<std::vector<std::complex<double>>> & result);
+
+        // Breit-Wigner pole at a single s or on a grid of s
+        inline std::complex<double> breit_wigner(double s)
+        {
+            return 1. / (s + XI * _mRes * _gamRes - _mRes * _mRes);
+        };
+        void breit_wigner(const std::vector<double> & s, std::vector<std::complex<double>> & result);
+
+        // Saved d-functions are recalculated when switching between tables and exact evaluation
+        inline void use_wigner_tables(bool ifuse, double tolerance = 1.E-8, int budget = 1000000)
+        {
+            amplitude::use_wigner_tables(ifuse, tolerance, budget);
+            _saved_z = 2.;
+        };
+
         // only vector kinematics allowed
         inline std::vector<std::array<int,2>> allowedJP()
         {
@@ -102,6 +124,26 @@ namespace jpacPhoto
         // Initial and final CoM momenta evaluated at resonance energy.
         double _pibar, _pfbar;
 
+        // Energy independent parts of the photo-couplings for |lam_i| = 1, 3 and of the hadronic coupling
+        // recalculated whenever the parameters change
+        std::complex<double> _photo_norm[2] = {0., 0.}, _hadronic_norm = 0.;
+        void update_couplings();
+
+        // Energy dependence of both couplings, the threshold factor, and the pole
+        // only recalculated when s, mX2 or Q2 change, or with the Breit-Wigner at s already evaluated
+        double _saved_s = -1., _saved_mX2 = 0., _saved_mB2 = 0.;
+        std::complex<double> _photo_s = 0., _hadronic_s = 0., _pole = 0.;
+        void update_s_factors();
+        void update_s_factors(std::complex<double> bw);
+
+        // d-functions for every lam_i, lam_f [(lam_i + 3) / 2][(lam_f + 3) / 2] at the saved angle
+        std::complex<double> _saved_z = 2.;
+        std::complex<double> _wigner[4][4];
+        void update_wigner(std::complex<double> z);
+
+        // Fill all helicity amplitudes from the saved couplings and d-functions
+        void fill_helicity_amplitudes(std::vector<std::complex<double>> & result);
+
         // saved energies and angle
         double _s, _t, _theta;
     };
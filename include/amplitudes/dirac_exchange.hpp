@@ -45,11 +45,15 @@ namespace jpacPhoto
         {
             _useFF = FF;
             _cutoff = bb;
+            params_changed();
         }
 
         // Assemble the helicity amplitude by contracting the spinor indices
         std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t);
 
+        // All helicities at once, the propagator and each vertex are only calculated once per point
+        void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+
         // debugging options to make either the photon or vector into scalars
         inline void set_debug(int i)
         {
@@ -59,6 +63,7 @@ namespace jpacPhoto
             case 2: _scTOP = true; break;
             case 1: _scBOT = true; break;
             }
+            params_changed();
         }
 
         // only vector and psuedo-scalar kinematics
@@ -85,23 +90,24 @@ namespace jpacPhoto
         // couplings
         double _gGam = 0., _gVec = 0.;
 
-        // Should be exactly u_man(s, zs);
-        double exchange_mass();
-
-        // Slashed momentumn
-        std::complex<double> slashed_exchange_momentum(int i, int j);
+        // Save energies and angle and update everything which does not depend on helicities
+        void update_kinematics(double s, double t);
 
-        // Slashed polarization vectors
-        std::complex<double> slashed_eps(int i, int j, double lam, polarization_vector * eps, bool STARRED, double s, double theta);
+        // Photon - excNucleon - recNucleon vertex as a row in spinor space
+        // (ubar epsilon-slashed)
+        void top_vertex(int lam_gam, int lam_rec, std::complex<double> row[4]);
 
-        // Photon - excNucleon - recNucleon vertex
-        std::complex<double> top_vertex(int i, int lam_gam, int lam_rec);
+        // excNucleon - recNucleon - Vector vertex as a column in spinor space
+        // (epsilon*-slashed u)
+        void bottom_vertex(int lam_vec, int lam_targ, std::complex<double> column[4]);
 
-        // excNucleon - recNucleon - Vector vertex
-        std::complex<double> bottom_vertex(int j, int lam_vec, int lam_targ);
+        // Propagator as a 4x4 dirac matrix, only recalculated when s, theta, or masses change
+        double _saved_s = -1., _saved_theta = 0., _saved_mX2 = 0., _saved_mB2 = 0.;
+        std::complex<double> _propagator[4][4];
+        void update_propagator();
 
-        // Spin-1/2 propagator
-        std::complex<double> dirac_propagator(int i, int j);
+        // Spin-1/2 propagator (p-slash + m) / (p^2 - m^2)
+        virtual void calculate_propagator();
     };
 };
 #endif
@@ -24,6 +24,11 @@
 // 1. top_vertex() coupling the vector meson to the incoming photon
 // 2. bottom_vertex() coupling the two proton dirac spinors
 // 3. regge_factor() the function describing the energy dependence of the amplitude
+//
+// For models 0 and 2 the contraction of the two vertices is by default replaced by
+// closed-form helicity amplitudes in the CoM frame (see pomeron_exchange.cpp).
+// Pass analytic = false to the constructor, or use force_covariant(true),
+// to contract the lorentz vectors explicitly instead.
 // ---------------------------------------------------------------------------
 
 namespace jpacPhoto
@@ -34,8 +39,8 @@ namespace jpacPhoto
 
         // Constructor
         // need a pointer to kinematic object, pointer to trajectory.
-        pomeron_exchange(reaction_kinematics * xkinem, regge_trajectory * alpha, int model = 0, std::string name = "pomeron_exchange")
-        : amplitude(xkinem, name), _traj(alpha), _model(model)
+        pomeron_exchange(reaction_kinematics * xkinem, regge_trajectory * alpha, int model = 0, std::string name = "pomeron_exchange", bool analytic = true)
+        : amplitude(xkinem, name), _traj(alpha), _model(model), _analytic(analytic)
         {
             set_nParams(2);
             check_JP(xkinem->_jp);
@@ -47,11 +52,30 @@ namespace jpacPhoto
             check_nParams(params);
             _norm = params[0];
             _b0 = params[1];
+            _tFactors.clear(); _saved_s = -1.;
+        };
+
+        // Switch between the closed-form amplitudes and contracting the vertices
+        inline void force_covariant(bool x)
+        {
+            _analytic = !x;
+            params_changed();
+        };
+
+        // Changing the parameters of the trajectory also changes the amplitude
+        inline int params_version()
+        {
+            return _paramsVersion + _traj->version();
         };
 
         // Assemble the helicity amplitude by contracting the lorentz indices
         std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t);
 
+        // All helicities at once with the regge factor and both vertices calculated once per point.
+        // With a vector of t, the trajectory is evaluated for the whole grid together
+        void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+        void helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result);
+
         // only vector kinematics allowed
         inline std::vector<std::array<int,2>> allowedJP()
         {
@@ -70,13 +94,46 @@ namespace jpacPhoto
         regge_trajectory * _traj;
 
         // Photon - Vector - Pomeron vertex
-        std::complex<double> top_vertex(int mu, int lam_gam, int lam_vec);
+        lorentz_vector top_vertex(int lam_gam, int lam_vec);
 
         // Nucleon - Nucleon - Pomeron vertex
-        std::complex<double> bottom_vertex(int mu, int lam_targ, int lam_rec);
+        lorentz_vector bottom_vertex(int lam_targ, int lam_rec);
+
+        // Closed-form contraction of both vertices for models 0 and 2
+        bool _analytic = true;
+        std::complex<double> analytic_amplitude(int lam_gam, int lam_targ, int lam_vec, int lam_rec);
+
+        // Helicity independent pieces of the closed-form amplitudes, only recalculated when s, theta, or masses change
+        double _saved_analytic_s = -1., _saved_theta = 0., _saved_analytic_mX2 = 0., _saved_mB2 = 0.;
+        double _cos = 1., _sin = 0.;                        // cos and sin of theta
+        std::complex<double> _k_gam, _E_vec, _k_vec, _m_vec;  // photon momentum, vector energy, momentum, and mass
+        std::complex<double> _qJ[2][2], _vJ[2][2];            // nucleon current contracted with q_gam and q_vec [lam_targ][lam_rec]
+        std::complex<double> _XJ[2][2], _YJ[2][2];            // x and -i times y components of the current over sqrt(2)
+        void update_analytic();
 
         // Energy dependence from Pomeron propogator
         std::complex<double> regge_factor();
+        std::complex<double> regge_factor(std::complex<double> alpha_t);
+
+        // Multiply the contracted vertices for every helicity by the regge factor at the saved kinematics
+        void fill_helicity_amplitudes(std::complex<double> regge, std::vector<std::complex<double>> & result);
+
+        // Pieces of the regge_factor which only depend on t
+        struct regge_t_factors
+        {
+            double mX2;
+            std::complex<double> alpha;
+            std::complex<double> residue; // t-dependence of the coupling (form factors etc.)
+        };
+        t_cache<regge_t_factors> _tFactors;
+        const regge_t_factors & t_factors(std::complex<double> alpha_t);
+
+        // and those which only depend on s
+        // (through t_min these also depend on the masses and in model 2 on the trajectory)
+        double _saved_s = -1., _saved_mX2 = 0., _saved_s_mB2 = 0.;
+        int _saved_traj_version = -1;
+        double _s_factor = 1., _log_s = 0.;
+        void update_s_factors();
     };
 };
 
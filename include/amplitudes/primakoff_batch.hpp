@@ -0,0 +1,101 @@
+// Primakoff production off several nuclear targets at once
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+// References:
+// [1] arXiv:2008.01001 [hep-ph]
+// ---------------------------------------------------------------------------
+
+#ifndef _PRIMAKOFF_BATCH_
+#define _PRIMAKOFF_BATCH_
+
+#include "nuclear_target.hpp"
+#include "reaction_kinematics.hpp"
+#include "amplitudes/primakoff_effect.hpp"
+
+#include <functional>
+#include <thread>
+
+// ---------------------------------------------------------------------------
+// primakoff_batch sets up a reaction_kinematics and primakoff_effect for each
+// nuclear_target, sharing the produced meson, Q2, and X -> gamma gamma* coupling.
+//
+// Observables are returned as [target][energy] with each target
+// evaluated in its own thread.
+//
+// primakoff_batch batch(M_X3872, {"Zn70", "Sn124", "U238"}, Q2, coupling);
+// std::vector<std::vector<double>> sigma = batch.integrated_xsection(W);
+// ---------------------------------------------------------------------------
+
+namespace jpacPhoto
+{
+    class primakoff_batch
+    {
+        public:
+
+        // Constructor
+        primakoff_batch(double mX, std::vector<std::string> targets, double Q2, double coupling);
+
+        // Destructor
+        ~primakoff_batch();
+
+        // The kinematics and amplitudes are owned by the batch so it cannot be copied
+        primakoff_batch(const primakoff_batch &) = delete;
+        primakoff_batch & operator=(const primakoff_batch &) = delete;
+
+        // Longitudinal (0) or transverse (1) photon for all targets
+        inline void set_LT(int LT)
+        {
+            for (int i = 0; i < _amps.size(); i++) _amps[i]->set_LT(LT);
+        };
+
+        inline void set_Q2(double Q2)
+        {
+            for (int i = 0; i < _kinematics.size(); i++) _kinematics[i]->set_Q2(Q2);
+        };
+
+        inline void set_coupling(double coupling)
+        {
+            for (int i = 0; i < _amps.size(); i++) set_params(i, coupling);
+        };
+
+        // Whether to evaluate each target in its own thread (default true)
+        inline void set_parallel(bool x)
+        {
+            _parallel = x;
+        };
+
+        // Access to the individual targets and amplitudes
+        inline int size(){ return _targets.size(); };
+        inline nuclear_target target(int i){ return _targets[i]; };
+        inline primakoff_effect * amplitude(int i){ return _amps[i]; };
+
+        // Evaluate F(i, x) for each target i at every x
+        // F should only use amplitude(i) and target(i) so targets can be evaluated in parallel
+        std::vector<std::vector<double>> evaluate(std::function<double(int, double)> F, const std::vector<double> & x);
+
+        // Integrated cross-section in NANOBARN at each W in GeV
+        // or at W per nucleon, scaled by A of each target, if per_nucleon = true
+        std::vector<std::vector<double>> integrated_xsection(const std::vector<double> & W, bool per_nucleon = false);
+
+        // Differential cross-section in NANOBARN at fixed W (or W per nucleon) for each t
+        std::vector<std::vector<double>> differential_xsection(double W, const std::vector<double> & t, bool per_nucleon = false);
+
+        private:
+
+        bool _parallel = true;
+
+        std::vector<nuclear_target> _targets;
+        std::vector<reaction_kinematics *> _kinematics;
+        std::vector<primakoff_effect *> _amps;
+
+        inline void set_params(int i, double coupling)
+        {
+            _amps[i]->set_params({double(_targets[i]._Z), _targets[i]._radius, _targets[i]._skin, coupling});
+        };
+    };
+};
+
+#endif
@@ -10,6 +10,8 @@
 
 #include "amplitude.hpp"
 
+#include "Math/Interpolator.h"
+
 namespace jpacPhoto
 {
     class primakoff_effect : public amplitude
@@ -32,6 +34,25 @@ namespace jpacPhoto
             _photonCoupling = params[3];
 
             calculate_norm();
+            build_form_factor_table();
+        };
+
+        // Calculate the normalization and form factor of the charge distribution by numerical integration
+        // instead of in closed form, e.g. to validate the latter (default false)
+        inline void force_numerical(bool x)
+        {
+            _numerical = x;
+            if (_skinThickness > 0.) { calculate_norm(); build_form_factor_table(); };
+        };
+
+        // With numerical integration the form factor is interpolated from a table in |q|, which is refined
+        // until the interpolation error is below tol (absolute, F(0) = 1) up to a maximum of nMax points.
+        // Set tol <= 0 to always calculate the fourier transform directly.
+        inline void set_form_factor_tolerance(double tol, int nMax = 8193)
+        {
+            _ffTolerance = tol;
+            _ffMaxPoints = nMax;
+            if (_skinThickness > 0.) build_form_factor_table();
         };
 
         inline void set_LT(int LT)
@@ -80,47 +101,105 @@ namespace jpacPhoto
         // Normalized fourier transform of the above charge_distributions 
         double form_factor(double x);
         double _formFactor; // Form factor at energy t
-        
+
+        // Whether to integrate numerically or use the closed forms (default)
+        bool _numerical = false;
+
         void calculate_norm();     
         double _rho0 = 0.;  // normalizaton
+
+        // Closed form of the fourier transform
+        double analytic_form_factor(double q);
+
+        // Radial moments int dr r^n charge_distribution(r) from the complete Fermi-Dirac integrals
+        double fermi_moment(int n);
+        double fermi_dirac(int j, double x);
+
+        // Coefficients of q^2k in the expansion of the form factor at small q
+        static const int _nMoments = 6;
+        double _ffMoments[_nMoments];
+
+        // Fourier transform by numerical integration
+        double numerical_form_factor(double q);
+
+        // Cubic spline of the numerical form factor in |q| up to _ffMaxQ, built once in set_params
+        // outside the table or if it failed to converge the fourier transform is calculated directly
+        ROOT::Math::Interpolator _ffTable;
+        bool   _ffTabulated = false;
+        double _ffTolerance = 1.E-7;
+        int    _ffMaxPoints = 8193;
+        double _ffMaxQ = 0.;
+        void build_form_factor_table();
+
         inline double W_00()
         {
             return 64. * _atomicZ*_atomicZ * _mA2 * _mA2 * _mA2 * _formFactor * _formFactor / ((_t - 4.*_mA2) * (_t - 4.*_mA2));
         };
 
         // Kinematic quantities   
-        long double _mX2 =  _kinematics->_mX2;
-        long double _mA2 =  _kinematics->_mT2;
-        long double _mQ2  = -_kinematics->_mB2;
-
-        long double _cosX, _sinX2;
-        long double _pGam, _pX;
-        long double _nu, _enX;
+        double _mX2 =  _kinematics->_mX2;
+        double _mA2 =  _kinematics->_mT2;
+        double _mQ2  = -_kinematics->_mB2;
+
+        double _cosX, _sinX2;         // scattering angle of the X in the lab frame
+        double _cosHalfX2, _sinHalfX2; // and squares of cosine and sine of half of it
+        double _pGam, _pX;
+        double _nu, _enX;
         inline void update_kinematics()
         {
+            // Masses may have changed since construction (e.g. with set_Q2)
+            _mX2 = _kinematics->_mX2; _mA2 = _kinematics->_mT2; _mQ2 = -_kinematics->_mB2;
+
+            double mA = sqrt(_mA2), mX = sqrt(_mX2);
+
             // lab frame momentum transfer
-            _nu = (_s - _mA2 + _mQ2) / (2. * sqrt(_mA2));
+            _nu = (_s - _mA2 + _mQ2) / (2. * mA);
 
             // Momentum of photon
             _pGam = sqrt(_nu*_nu + _mQ2);
 
-            // // Momentum of the X
-            _pX  = sqrt(_t*_t + 4.*sqrt(_mA2)*_t*_nu + 4.*_mA2*(_nu*_nu - _mX2));
-            _pX /= 2. * sqrt(_mA2);
+            // Energy of the X, everything not taken by the recoiling nucleus
+            _enX = _nu + _t / (2. * mA);
 
-            // Energy of the X
-            _enX = sqrt(_pX*_pX + _mX2);
+            // Momentum of the X
+            _pX = sqrt((_enX - mX) * (_enX + mX));
 
             // Cosine of scattering angle of the X in the lab frame
             _cosX  = _t + _mQ2 - _mX2 + 2.*_nu*_enX;
             _cosX /= 2. * _pX * _pGam;
 
-            // // Sine of the above 
-            _sinX2 = 1. - _cosX * _cosX;
+            // The sine follows from the transverse momentum instead of 1 - cos^2 
+            // which would cancel in the forward direction
+            _sinX2 = transverse_momentum2() / (_pX * _pX);
+
+            // Same for the half angles
+            _cosHalfX2 = (_cosX >= 0.) ? (1. + _cosX) / 2.            : _sinX2 / (2. * (1. - _cosX));
+            _sinHalfX2 = (_cosX >= 0.) ? _sinX2 / (2. * (1. + _cosX)) : (1. - _cosX) / 2.;
+        };
+
+        // Square of the momentum of the X transverse to the photon, which is the same in the lab and CM frames
+        // p_T^2 = (t_min - t)(t - t_max) / 4 k^2 with k the CM momentum of the photon
+        inline double transverse_momentum2()
+        {
+            double sqs = sqrt(_s);
+            double mA = sqrt(_mA2), mX = sqrt(_mX2);
+
+            // CM energies and momenta
+            double Egam = (_s - _mQ2 - _mA2) / (2. * sqs);
+            double EX   = (_s + _mX2 - _mA2) / (2. * sqs);
+            double k    = mA * _pGam / sqs;
+            double p    = sqrt((_s - (mA + mX)*(mA + mX)) * (_s - (mA - mX)*(mA - mX))) / (2. * sqs);
+
+            // t_max directly and t_min from t_min t_max = (mX^2 + Q^2)^2 mA^2 / s
+            // since t_min is the small difference of large terms for heavy nuclei
+            double t_max = _mX2 - _mQ2 - 2. * (Egam * EX + k * p);
+            double t_min = (_mX2 + _mQ2) * (_mX2 + _mQ2) * _mA2 / (_s * t_max);
+
+            return (t_min - _t) * (_t - t_max) / (4. * k * k);
         };
 
         // Spin summed amplitude squared
-        long double amplitude_squared();
+        double amplitude_squared();
     };
 };
 
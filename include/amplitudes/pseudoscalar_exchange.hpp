@@ -20,7 +20,7 @@
 //
 // Initialization required a reaction_kinematics object.
 // Then either: the mass (in GeV) of the exchange (for fixed-spin exchange),
-//          or: a pointer to a linear_trajectory object (for Reggeize exchange).
+//          or: a pointer to a regge_trajectory object (for Reggeize exchange).
 // and an optional string to identify the amplitude with.
 //
 // Evaluation requires two couplings:
@@ -41,23 +41,20 @@ namespace jpacPhoto
             set_nParams(2);
             check_JP(xkinem->_jp);
 
-            // Only axial vector is available for analytic residue evaluation
-            if (xkinem->_jp[0] != 1 && xkinem->_jp[1] != 1) _useFourVecs = true;
+            // Analytic residues are the default only for axial-vector production
+            if (!(xkinem->_jp[0] == 1 && xkinem->_jp[1] == 1)) _useFourVecs = true;
         };
 
         // constructors for regge exchange
-        pseudoscalar_exchange(reaction_kinematics * xkinem, linear_trajectory * traj, std::string name = "pseudoscalar_exchange")
+        pseudoscalar_exchange(reaction_kinematics * xkinem, regge_trajectory * traj, std::string name = "pseudoscalar_exchange")
         : amplitude(xkinem, name), _alpha(traj), _reggeized(true)
         {
             set_nParams(2);
             check_JP(xkinem->_jp);
 
-            // Only axial vector is available for analytic residue evaluation
-            if (xkinem->_jp[0] != 1 && xkinem->_jp[1] != 1)
-            {
-                std::cout << "Error! Only reggeized axial vector production implemented so far!" << std::endl;
-                exit(0);
-            }
+            // Analytic residues only available for axial-vector production,
+            // otherwise the residues are given by the Feynman rules vertices
+            if (!(xkinem->_jp[0] == 1 && xkinem->_jp[1] == 1)) _useFourVecs = true;
         };
 
         // Setting utility
@@ -73,11 +70,39 @@ namespace jpacPhoto
         {
             _useFF = FF;
             _b = bb;
+            params_changed();
         }
 
+        // Evaluate by contracting Feynman rules instead of with the analytic residues.
+        // If reggeized, the pole of the propagator is replaced by the Regge propagator.
+        // The analytic residues are only available for axial-vector production
+        inline void force_covariant(bool x)
+        {
+            if (x == false && !(_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == 1))
+            {
+                std::cout << "Warning! Analytic residues in " << _identifier << " only available for axial vector production. Using Feynman rules.\n";
+                return;
+            }
+
+            _useFourVecs = x;
+            params_changed();
+        };
+
+        // Changing the parameters of the trajectory also changes the amplitude
+        inline int params_version()
+        {
+            return (_reggeized) ? _paramsVersion + _alpha->version() : _paramsVersion;
+        };
+
         // Assemble the helicity amplitude by contracting the spinor indices
         std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double xs, double xt);
 
+        // All helicities at once, the propagator and form factor are only calculated once per point
+        // and helicities with vanishing residues are skipped.
+        // With a vector of t, the trajectory is evaluated for the whole grid together
+        void helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result);
+        void helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result);
+
         // only axial-vector, vector, and pseudo-scalar available
         inline std::vector<std::array<int,2>> allowedJP()
         {
@@ -95,7 +120,7 @@ namespace jpacPhoto
 
         // Regge trajectory for the pion (if REGGE = true)
         // ignored otherwise
-        linear_trajectory * _alpha;
+        regge_trajectory * _alpha;
 
         // Coupling constants
         double _gGamma = 0.; // Gamma - Axial - Pseudoscalar coupling 
@@ -113,8 +138,22 @@ namespace jpacPhoto
         // Pseudoscalar - Nucleon vertex
         std::complex<double> bottom_vertex(double lam_targ, double lam_rec);
 
+        // Analytic residues of the above in the t-channel
+        std::complex<double> top_residue(int lam_gam, int lam_vec);
+        std::complex<double> bottom_residue(int lam_targ, int lam_rec);
+
         // Simple pole propagator
         std::complex<double> scalar_propagator();
+
+        // Regge propagator for given value of the trajectory and its slope at _t
+        std::complex<double> regge_propagator(std::complex<double> alpha_t, std::complex<double> slope_t);
+
+        // Exponential form factor if used
+        double form_factor();
+
+        // Multiply the helicity dependent vertices by the propagator and form factor (scalar)
+        // for every helicity at the saved kinematics
+        void fill_helicity_amplitudes(std::complex<double> scalar, std::vector<std::complex<double>> & result);
     };
 };
 
@@ -21,22 +21,17 @@ namespace jpacPhoto
         : dirac_exchange(xkinem, mass, name)
         {};
 
-        // Assemble the helicity amplitude by contracting the spinor indices
-        std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double xs, double xt);
-
         protected:
 
-        // rank-2 traceless tensor
-        std::complex<double> g_bar(int mu, int nu);
-
-        // g_bar contracted with gamma^nu
-        std::complex<double> slashed_g_bar(int mu, int i, int j);
+        // Which pair of particles the relative momentum is taken between
+        enum momentum_leg { kInitial, kFinal };
 
-        // Relative momentum entering or exiting the propagator
-        std::complex<double> relative_momentum(int mu, std::string in_out);
+        // Relative momentum entering (initial state) or exiting (final state) the propagator
+        lorentz_vector relative_momentum(momentum_leg leg);
 
-        // Spin-3/2 propagator
-        std::complex<double> rarita_propagator(int i, int j);
+        // Spin-3/2 propagator contracted with both relative momenta as a 4x4 dirac matrix
+        // replaces the spin-1/2 propagator in dirac_exchange, everything else is the same
+        void calculate_propagator();
     };
 };
 
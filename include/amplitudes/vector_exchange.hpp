@@ -37,22 +37,20 @@ namespace jpacPhoto
             set_nParams(3);
             check_JP(xkinem->_jp);
 
-            // Analytical residues only available for axial-vector production
-            if (xkinem->_jp[0] != 1 && xkinem->_jp[1] != 1) _useCovariant = true;
+            // Analytic residues are the default only for axial-vector production
+            if (!(xkinem->_jp[0] == 1 && xkinem->_jp[1] == 1)) _useCovariant = true;
         };
 
         // Constructor for the reggized)
-        vector_exchange(reaction_kinematics * xkinem, linear_trajectory * traj, std::string id = "vector_exchange")
+        vector_exchange(reaction_kinematics * xkinem, regge_trajectory * traj, std::string id = "vector_exchange")
         : amplitude(xkinem, id), _alpha(traj), _ifReggeized(true)
         {
             set_nParams(3);
             check_JP(xkinem->_jp);
 
-            if (xkinem->_jp[0] != 1 && xkinem->_jp[1] != 1)
-            {
-                std::cout << "Error! Reggeized vector_exchange only implemented for axial vector production so far.\n";
-                exit(0);
-            }
+            // Analytic residues only available for axial-vector production,
+            // otherwise the residues are given by the Feynman rules vertices
+            if (!(xkinem->_jp[0] == 1 && xkinem->_jp[1] == 1)) _useCovariant = true;
         };
 
         // Setting utility
@@ -62,6 +60,7 @@ namespace jpacPhoto
             _gGam = params[0];
             _gV = params[1];
             _gT = params[2];
+            _tFactors.clear(); _saved_s = -1.;
         };
 
         // Whether or not to include an exponential form factor (default false)
@@ -69,8 +68,31 @@ namespace jpacPhoto
         {
             _useFormFactor = FF;
             _cutoff = bb;
+            params_changed();
         }
 
+        // Evaluate by contracting Feynman rules instead of with the analytic residues.
+        // If reggeized, the pole of the propagator is replaced by the Regge propagator.
+        // The analytic residues are only available for axial-vector production
+        // and for non-elastic baryon vertices they only contain the spin-one part of the propagator.
+        inline void force_covariant(bool x)
+        {
+            if (x == false && !(_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == 1))
+            {
+                std::cout << "Warning! Analytic residues in " << _identifier << " only available for axial vector production. Using Feynman rules.\n";
+                return;
+            }
+
+            _useCovariant = x;
+            params_changed();
+        };
+
+        // Changing the parameters of the trajectory also changes the amplitude
+        inline int params_version()
+        {
+            return (_ifReggeized) ? _paramsVersion + _alpha->version() : _paramsVersion;
+        };
+
         // Assemble the helicity amplitude by contracting the lorentz indices
         std::complex<double> helicity_amplitude(std::array<int, 4> helicities, double s, double t);
 
@@ -85,7 +107,7 @@ namespace jpacPhoto
         // if using reggeized propagator
         bool _ifReggeized;
         // or the regge trajectory of the exchange
-        linear_trajectory * _alpha;
+        regge_trajectory * _alpha;
         double _zt;
 
         // Whether using analytic or covariant expression
@@ -109,18 +131,28 @@ namespace jpacPhoto
         std::complex<double> covariant_amplitude(std::array<int, 4> helicities);
 
         // Photon - Axial Vector - Vector vertex
-        std::complex<double> top_vertex(int mu, int lam_gam, int lam_vec);
+        lorentz_vector top_vertex(int lam_gam, int lam_vec);
 
         // Nucleon - Nucleon - Vector vertex
-        std::complex<double> bottom_vertex(int nu, int lam_targ, int lam_rec);
+        lorentz_vector bottom_vertex(int lam_targ, int lam_rec);
 
         // Vector propogator
-        std::complex<double> vector_propagator(int mu, int nu);
+        // or only its numerator, projecting onto spin-one at mass^2 = t, if reggeized
+        lorentz_tensor vector_propagator();
+
+        // Regge propagator replacing the pole 1 / (t - mEx2) of the Feynman rules
+        std::complex<double> covariant_regge_factor();
+
+        // Vertices for every helicity at the current kinematic point, only recalculated when s, t, or masses change
+        // top current [lam_gam + 1][lam_vec + 1] and bottom current already contracted with the propagator [lam_targ][lam_rec]
+        double _saved_s = -1., _saved_t = 0., _saved_mX2 = 0., _saved_mB2 = 0.;
+        lorentz_vector _top_current[3][3], _propagated_current[2][2];
+        void update_currents();
 
         // ---------------------------------------------------------------------------
         // Analytic evaluation
 
-        // Photon - Axial - Vector
+        // Photon - Meson - Vector
         std::complex<double> top_residue(int lam_gam, int lam_vec);
 
         // Nucleon - Nucleon - Vector
@@ -134,6 +166,18 @@ namespace jpacPhoto
 
         // Angular momentum barrier factor
         std::complex<double> barrier_factor(int j, int M);
+
+        // Factors of the Regge propagator which do not depend on energy
+        struct regge_t_factors
+        {
+            double mX2;
+            int version;                               // of the trajectory when saved
+            std::complex<double> alpha, slope;
+            std::complex<double> signature, log_gamma; // signature factor and log Gamma(1 - alpha)
+            std::complex<double> barrier;              // 2 p q, raised to the power j - M
+        };
+        t_cache<regge_t_factors> _tFactors;
+        const regge_t_factors & t_factors();
     };
 };
 
@@ -41,6 +41,12 @@ namespace jpacPhoto
         std::complex<double> component(int i, int lambda, double s, double theta);
         std::complex<double> adjoint_component(int i, int lambda, double s, double theta);
 
+        // Access the two_body_state defining the momenta
+        inline two_body_state * get_state(){ return _state; };
+
+        // Energy component, sqrt(E +- m)
+        std::complex<double> omega(int sign, double s);
+
         private:
 
         // masses, energies, and momenta
@@ -49,9 +55,6 @@ namespace jpacPhoto
         //Whether its an anti-particle or not
         const bool _antiParticle = false;
 
-        // Energy component
-        std::complex<double> omega(int sign, double s);
-
         // angular component
         double half_angle(int lam, double theta);
     };
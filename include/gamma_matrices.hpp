@@ -20,6 +20,16 @@ namespace jpacPhoto
     // Mostly minus metric
     const double METRIC[4] = {1., -1., -1., -1.};
 
+	// ---------------------------------------------------------------------------
+	// The basis for the gamma matrices and spinors is chosen at compile time.
+	// By default the Dirac basis is used. Defining JPAC_CHIRAL_BASIS
+	// (cmake -DCHIRAL_BASIS=ON) switches to the chiral (Weyl) basis where
+	// gamma^mu is block off-diagonal and gamma_5 = diag(-1, 1).
+	// Observables are identical in both, only the intermediate components differ.
+	// ---------------------------------------------------------------------------
+
+#ifndef JPAC_CHIRAL_BASIS
+
 	// Gamma matrix vector in Dirac basis
 	const std::complex<double> GAMMA[4][4][4] =
 	{
@@ -54,6 +64,44 @@ namespace jpacPhoto
         { 0., 1., 0., 0. }
 	};
 
+#else
+
+	// Gamma matrix vector in chiral basis
+	const std::complex<double> GAMMA[4][4][4] =
+	{
+	  //gamma0
+		{ { 0., 0., 1., 0. },
+	    { 0., 0., 0., 1. },
+	    { 1., 0., 0., 0. },
+	    { 0., 1., 0., 0. } },
+	  //gamma1
+		{ { 0., 0., 0., 1. },
+	    { 0., 0., 1., 0. },
+	    { 0., -1., 0., 0. },
+	    { -1., 0., 0., 0. } },
+	  //gamma2
+		{ { 0., 0., 0., -XI },
+	    { 0., 0., XI, 0. },
+	    { 0.,  XI, 0., 0. },
+	    { -XI, 0., 0., 0. } },
+	  //gamma3
+		{ { 0., 0., 1., 0. },
+	    { 0., 0., 0., -1. },
+	    { -1., 0., 0., 0. },
+	    { 0., 1., 0., 0. } }
+	};
+
+	// Gamma_5
+	const std::complex<double> GAMMA_5[4][4] =
+	{
+        { -1., 0., 0., 0. },
+        { 0., -1., 0., 0. },
+        { 0., 0., 1., 0. },
+        { 0., 0., 0., 1. }
+	};
+
+#endif
+
 	// ---------------------------------------------------------------------------
 	// Rank two gamma tensor
 	std::complex<double> sigma(int mu, int nu, int i, int j);
@@ -0,0 +1,592 @@
+// Complex four-vectors and rank-2 tensors with Minkowski contractions
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#ifndef _LORENTZ_
+#define _LORENTZ_
+
+#include <complex>
+
+#include "constants.hpp"
+#include "gamma_matrices.hpp"
+
+// ---------------------------------------------------------------------------
+// lorentz_vector stores contravariant components a^mu of a complex four-vector.
+// Real and imaginary parts are kept in separate arrays so contractions
+// are written purely in terms of doubles in fixed-length loops of 4 which the
+// compiler turns into packed SIMD instructions without going through
+// std::complex multiplication. The arrays carry no alignment requirement
+// beyond that of double so vectors and tensors (and classes holding them)
+// can be allocated with plain new; unaligned packed loads cost nothing extra
+// on hardware with AVX.
+//
+// The instruction set is SSE2 by default, the host's with -DNATIVE_ARCH=ON,
+// or picked at run time: functions marked with JPAC_SIMD_CLONES (see below)
+// are compiled once per instruction set and the widest one the CPU supports
+// is selected when the library is loaded. All the inline arithmetic below is
+// inlined into each clone.
+//
+// lorentz_tensor is similarly a rank-2 tensor T^{mu nu} with both indices up.
+// All metric factors are taken care of inside the contract() functions.
+//
+// Arithmetic is implemented with expression templates: sums, differences,
+// rescalings, lower() and conjugate() only build lightweight objects which are
+// evaluated component by component when assigned to a lorentz_vector or
+// lorentz_tensor, or when passed to contract(). For example
+//
+//      contract(a, (outer(q, q) / m2 - metric()) / (t - m2), b)
+//
+// is a single fused double loop with no intermediate vectors or tensors.
+// Expressions hold references to the vectors they are built from so they should
+// never be stored with auto, always assign them to a concrete type.
+// ---------------------------------------------------------------------------
+
+// ---------------------------------------------------------------------------
+// Runtime dispatch for the functions doing the bulk of the contractions.
+// Requires GCC on x86-64 Linux (ifunc), otherwise the attribute is empty.
+// Out-of-line helpers called from a marked function (the vertices and
+// propagators of each amplitude) need the attribute as well, otherwise they
+// still run the default instruction set.
+#if defined(JPAC_SIMD_DISPATCH) && defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+    #define JPAC_SIMD_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+    #define JPAC_SIMD_CLONES
+#endif
+
+namespace jpacPhoto
+{
+    template<class A> class vector_lowered;
+    template<class A> class vector_conjugated;
+
+    // ---------------------------------------------------------------------------
+    // Base classes for anything which can be evaluated as a vector or tensor.
+    // Derived classes E need only supply eval() for a single component.
+
+    template<class E>
+    class vector_expression
+    {
+        public:
+
+        inline const E & self() const { return static_cast<const E&>(*this); };
+
+        inline std::complex<double> operator[](int mu) const
+        {
+            double re, im;
+            self().eval(mu, re, im);
+            return std::complex<double>(re, im);
+        };
+
+        // Components with the index lowered, a_mu = g_{mu nu} a^nu
+        inline vector_lowered<E> lower() const { return vector_lowered<E>(self()); };
+
+        // Complex conjugate of every component
+        inline vector_conjugated<E> conjugate() const { return vector_conjugated<E>(self()); };
+    };
+
+    template<class E>
+    class tensor_expression
+    {
+        public:
+
+        inline const E & self() const { return static_cast<const E&>(*this); };
+
+        inline std::complex<double> operator()(int mu, int nu) const
+        {
+            double re, im;
+            self().eval(mu, nu, re, im);
+            return std::complex<double>(re, im);
+        };
+    };
+
+    // Concrete vectors and tensors are held inside expressions by reference,
+    // intermediate expressions (which are temporaries) by value
+    template<class E> struct expression_storage { typedef const E type; };
+
+    // ---------------------------------------------------------------------------
+    // Four-vector a^mu
+    class lorentz_vector : public vector_expression<lorentz_vector>
+    {
+        public:
+
+        // Empty constructor is the zero vector
+        lorentz_vector()
+        {
+            for (int mu = 0; mu < 4; mu++) { _re[mu] = 0.; _im[mu] = 0.; }
+        };
+
+        // Constructor with explicit components
+        lorentz_vector(std::complex<double> a0, std::complex<double> a1, std::complex<double> a2, std::complex<double> a3)
+        {
+            set(0, a0); set(1, a1); set(2, a2); set(3, a3);
+        };
+
+        // Evaluate any vector expression
+        template<class E>
+        lorentz_vector(const vector_expression<E> & x)
+        {
+            for (int mu = 0; mu < 4; mu++) x.self().eval(mu, _re[mu], _im[mu]);
+        };
+
+        // Every component of an expression only depends on the same component
+        // of its arguments so aliasing is not a problem, i.e. a = a.lower() is fine
+        template<class E>
+        inline lorentz_vector & operator=(const vector_expression<E> & x)
+        {
+            for (int mu = 0; mu < 4; mu++) x.self().eval(mu, _re[mu], _im[mu]);
+            return *this;
+        };
+
+        // Access components
+        inline std::complex<double> operator[](int mu) const
+        {
+            return std::complex<double>(_re[mu], _im[mu]);
+        };
+
+        inline void eval(int mu, double & re, double & im) const
+        {
+            re = _re[mu]; im = _im[mu];
+        };
+
+        inline void set(int mu, std::complex<double> x)
+        {
+            _re[mu] = real(x); _im[mu] = imag(x);
+        };
+
+        inline bool operator==(const lorentz_vector & b) const
+        {
+            for (int mu = 0; mu < 4; mu++)
+            {
+                if (_re[mu] != b._re[mu] || _im[mu] != b._im[mu]) return false;
+            }
+            return true;
+        };
+
+        double _re[4];
+        double _im[4];
+    };
+
+    template<> struct expression_storage<lorentz_vector> { typedef const lorentz_vector & type; };
+
+    // ---------------------------------------------------------------------------
+    // Rank-2 tensor T^{mu nu}
+    class lorentz_tensor : public tensor_expression<lorentz_tensor>
+    {
+        public:
+
+        // Empty constructor is the zero tensor
+        lorentz_tensor()
+        {
+            for (int mu = 0; mu < 4; mu++)
+            {
+                for (int nu = 0; nu < 4; nu++) { _re[mu][nu] = 0.; _im[mu][nu] = 0.; }
+            }
+        };
+
+        // Evaluate any tensor expression
+        template<class E>
+        lorentz_tensor(const tensor_expression<E> & x)
+        {
+            assign(x);
+        };
+
+        template<class E>
+        inline lorentz_tensor & operator=(const tensor_expression<E> & x)
+        {
+            assign(x);
+            return *this;
+        };
+
+        inline std::complex<double> operator()(int mu, int nu) const
+        {
+            return std::complex<double>(_re[mu][nu], _im[mu][nu]);
+        };
+
+        inline void eval(int mu, int nu, double & re, double & im) const
+        {
+            re = _re[mu][nu]; im = _im[mu][nu];
+        };
+
+        inline void set(int mu, int nu, std::complex<double> x)
+        {
+            _re[mu][nu] = real(x); _im[mu][nu] = imag(x);
+        };
+
+        // Add c * g^{mu nu}
+        inline void add_metric(std::complex<double> c)
+        {
+            for (int mu = 0; mu < 4; mu++)
+            {
+                _re[mu][mu] += real(c) * METRIC[mu];
+                _im[mu][mu] += imag(c) * METRIC[mu];
+            }
+        };
+
+        double _re[4][4];
+        double _im[4][4];
+
+        private:
+
+        template<class E>
+        inline void assign(const tensor_expression<E> & x)
+        {
+            for (int mu = 0; mu < 4; mu++)
+            {
+                for (int nu = 0; nu < 4; nu++) x.self().eval(mu, nu, _re[mu][nu], _im[mu][nu]);
+            }
+        };
+    };
+
+    template<> struct expression_storage<lorentz_tensor> { typedef const lorentz_tensor & type; };
+
+    // ---------------------------------------------------------------------------
+    // Vector expressions
+
+    // a^mu +- b^mu
+    template<class A, class B, int SIGN>
+    class vector_sum : public vector_expression<vector_sum<A, B, SIGN>>
+    {
+        public:
+        vector_sum(const A & a, const B & b) : _a(a), _b(b) {};
+
+        inline void eval(int mu, double & re, double & im) const
+        {
+            double are, aim, bre, bim;
+            _a.eval(mu, are, aim); _b.eval(mu, bre, bim);
+            re = are + SIGN * bre; im = aim + SIGN * bim;
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+        typename expression_storage<B>::type _b;
+    };
+
+    // c a^mu for complex c
+    template<class A>
+    class vector_scaled : public vector_expression<vector_scaled<A>>
+    {
+        public:
+        vector_scaled(const A & a, std::complex<double> c) : _a(a), _cr(real(c)), _ci(imag(c)) {};
+
+        inline void eval(int mu, double & re, double & im) const
+        {
+            double are, aim;
+            _a.eval(mu, are, aim);
+            re = _cr * are - _ci * aim; im = _cr * aim + _ci * are;
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+        double _cr, _ci;
+    };
+
+    // g_{mu nu} a^nu
+    template<class A>
+    class vector_lowered : public vector_expression<vector_lowered<A>>
+    {
+        public:
+        vector_lowered(const A & a) : _a(a) {};
+
+        inline void eval(int mu, double & re, double & im) const
+        {
+            _a.eval(mu, re, im);
+            re *= METRIC[mu]; im *= METRIC[mu];
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+    };
+
+    // (a^mu)^*
+    template<class A>
+    class vector_conjugated : public vector_expression<vector_conjugated<A>>
+    {
+        public:
+        vector_conjugated(const A & a) : _a(a) {};
+
+        inline void eval(int mu, double & re, double & im) const
+        {
+            _a.eval(mu, re, im);
+            im = -im;
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+    };
+
+    template<class A, class B>
+    inline vector_sum<A, B, +1> operator+(const vector_expression<A> & a, const vector_expression<B> & b)
+    {
+        return vector_sum<A, B, +1>(a.self(), b.self());
+    };
+
+    template<class A, class B>
+    inline vector_sum<A, B, -1> operator-(const vector_expression<A> & a, const vector_expression<B> & b)
+    {
+        return vector_sum<A, B, -1>(a.self(), b.self());
+    };
+
+    template<class A>
+    inline vector_scaled<A> operator*(const vector_expression<A> & a, std::complex<double> c)
+    {
+        return vector_scaled<A>(a.self(), c);
+    };
+
+    template<class A>
+    inline vector_scaled<A> operator*(std::complex<double> c, const vector_expression<A> & a)
+    {
+        return vector_scaled<A>(a.self(), c);
+    };
+
+    template<class A>
+    inline vector_scaled<A> operator/(const vector_expression<A> & a, std::complex<double> c)
+    {
+        return vector_scaled<A>(a.self(), 1. / c);
+    };
+
+    // ---------------------------------------------------------------------------
+    // Tensor expressions
+
+    // a^mu b^nu
+    // both vectors are evaluated once when the product is formed since every
+    // component is needed four times
+    class outer_product : public tensor_expression<outer_product>
+    {
+        public:
+        outer_product(const lorentz_vector & a, const lorentz_vector & b) : _a(a), _b(b) {};
+
+        inline void eval(int mu, int nu, double & re, double & im) const
+        {
+            re = _a._re[mu] * _b._re[nu] - _a._im[mu] * _b._im[nu];
+            im = _a._re[mu] * _b._im[nu] + _a._im[mu] * _b._re[nu];
+        };
+
+        private:
+        const lorentz_vector _a, _b;
+    };
+
+    // g^{mu nu}
+    class metric_tensor : public tensor_expression<metric_tensor>
+    {
+        public:
+        inline void eval(int mu, int nu, double & re, double & im) const
+        {
+            re = (mu == nu) ? METRIC[mu] : 0.; im = 0.;
+        };
+    };
+
+    // T^{mu nu} +- S^{mu nu}
+    template<class A, class B, int SIGN>
+    class tensor_sum : public tensor_expression<tensor_sum<A, B, SIGN>>
+    {
+        public:
+        tensor_sum(const A & a, const B & b) : _a(a), _b(b) {};
+
+        inline void eval(int mu, int nu, double & re, double & im) const
+        {
+            double are, aim, bre, bim;
+            _a.eval(mu, nu, are, aim); _b.eval(mu, nu, bre, bim);
+            re = are + SIGN * bre; im = aim + SIGN * bim;
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+        typename expression_storage<B>::type _b;
+    };
+
+    // c T^{mu nu}
+    template<class A>
+    class tensor_scaled : public tensor_expression<tensor_scaled<A>>
+    {
+        public:
+        tensor_scaled(const A & a, std::complex<double> c) : _a(a), _cr(real(c)), _ci(imag(c)) {};
+
+        inline void eval(int mu, int nu, double & re, double & im) const
+        {
+            double are, aim;
+            _a.eval(mu, nu, are, aim);
+            re = _cr * are - _ci * aim; im = _cr * aim + _ci * are;
+        };
+
+        private:
+        typename expression_storage<A>::type _a;
+        double _cr, _ci;
+    };
+
+    inline outer_product outer(const lorentz_vector & a, const lorentz_vector & b)
+    {
+        return outer_product(a, b);
+    };
+
+    inline metric_tensor metric()
+    {
+        return metric_tensor();
+    };
+
+    template<class A, class B>
+    inline tensor_sum<A, B, +1> operator+(const tensor_expression<A> & a, const tensor_expression<B> & b)
+    {
+        return tensor_sum<A, B, +1>(a.self(), b.self());
+    };
+
+    template<class A, class B>
+    inline tensor_sum<A, B, -1> operator-(const tensor_expression<A> & a, const tensor_expression<B> & b)
+    {
+        return tensor_sum<A, B, -1>(a.self(), b.self());
+    };
+
+    template<class A>
+    inline tensor_scaled<A> operator*(const tensor_expression<A> & a, std::complex<double> c)
+    {
+        return tensor_scaled<A>(a.self(), c);
+    };
+
+    template<class A>
+    inline tensor_scaled<A> operator*(std::complex<double> c, const tensor_expression<A> & a)
+    {
+        return tensor_scaled<A>(a.self(), c);
+    };
+
+    template<class A>
+    inline tensor_scaled<A> operator/(const tensor_expression<A> & a, std::complex<double> c)
+    {
+        return tensor_scaled<A>(a.self(), 1. / c);
+    };
+
+    // ---------------------------------------------------------------------------
+    // Minkowski contractions
+    // Vector arguments which are needed more than once are evaluated a single time first
+
+    // a^mu g_{mu nu} b^nu
+    template<class A, class B>
+    inline std::complex<double> contract(const vector_expression<A> & a, const vector_expression<B> & b)
+    {
+        double re = 0., im = 0.;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            double are, aim, bre, bim;
+            a.self().eval(mu, are, aim); b.self().eval(mu, bre, bim);
+            re += METRIC[mu] * (are * bre - aim * bim);
+            im += METRIC[mu] * (are * bim + aim * bre);
+        }
+        return std::complex<double>(re, im);
+    };
+
+    // T^{mu nu} g_{nu alpha} b^alpha
+    template<class T, class B>
+    inline lorentz_vector contract(const tensor_expression<T> & t, const vector_expression<B> & x)
+    {
+        const lorentz_vector b(x.lower());
+
+        lorentz_vector result;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            double re = 0., im = 0.;
+            for (int nu = 0; nu < 4; nu++)
+            {
+                double tre, tim;
+                t.self().eval(mu, nu, tre, tim);
+                re += tre * b._re[nu] - tim * b._im[nu];
+                im += tre * b._im[nu] + tim * b._re[nu];
+            }
+            result._re[mu] = re; result._im[mu] = im;
+        }
+        return result;
+    };
+
+    // a^alpha g_{alpha mu} T^{mu nu}
+    template<class A, class T>
+    inline lorentz_vector contract(const vector_expression<A> & x, const tensor_expression<T> & t)
+    {
+        const lorentz_vector a(x.lower());
+
+        lorentz_vector result;
+        for (int nu = 0; nu < 4; nu++)
+        {
+            double re = 0., im = 0.;
+            for (int mu = 0; mu < 4; mu++)
+            {
+                double tre, tim;
+                t.self().eval(mu, nu, tre, tim);
+                re += a._re[mu] * tre - a._im[mu] * tim;
+                im += a._re[mu] * tim + a._im[mu] * tre;
+            }
+            result._re[nu] = re; result._im[nu] = im;
+        }
+        return result;
+    };
+
+    // a^mu g_{mu alpha} T^{alpha beta} g_{beta nu} b^nu
+    // evaluated as a single double sum so each component of T is only needed once
+    template<class A, class T, class B>
+    inline std::complex<double> contract(const vector_expression<A> & x, const tensor_expression<T> & t, const vector_expression<B> & y)
+    {
+        const lorentz_vector a(x.lower()), b(y.lower());
+
+        double re = 0., im = 0.;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            double row_re = 0., row_im = 0.;
+            for (int nu = 0; nu < 4; nu++)
+            {
+                double tre, tim;
+                t.self().eval(mu, nu, tre, tim);
+                row_re += tre * b._re[nu] - tim * b._im[nu];
+                row_im += tre * b._im[nu] + tim * b._re[nu];
+            }
+            re += a._re[mu] * row_re - a._im[mu] * row_im;
+            im += a._re[mu] * row_im + a._im[mu] * row_re;
+        }
+        return std::complex<double>(re, im);
+    };
+
+    // ---------------------------------------------------------------------------
+    // Levi-Civita symbol contracted with three vectors
+    // v[mu] = epsilon(mu, alpha, beta, gamma) a[alpha] b[beta] c[gamma], epsilon(0,1,2,3) = +1
+    //
+    // The symbol is summed against the stored (contravariant) components as they are,
+    // any raising or lowering of indices is left to the caller.
+    // Each component is a 3x3 determinant so only 24 of the 256 terms are ever computed.
+
+    inline std::complex<double> levi_civita_minor(const lorentz_vector & a, const lorentz_vector & b, const lorentz_vector & c,
+                                                  int i, int j, int k)
+    {
+        std::complex<double> result;
+        result  = a[i] * (b[j] * c[k] - b[k] * c[j]);
+        result -= a[j] * (b[i] * c[k] - b[k] * c[i]);
+        result += a[k] * (b[i] * c[j] - b[j] * c[i]);
+        return result;
+    };
+
+    template<class A, class B, class C>
+    inline lorentz_vector levi_civita(const vector_expression<A> & x, const vector_expression<B> & y, const vector_expression<C> & z)
+    {
+        const lorentz_vector a(x), b(y), c(z);
+
+        return lorentz_vector( levi_civita_minor(a, b, c, 1, 2, 3), - levi_civita_minor(a, b, c, 0, 2, 3),
+                               levi_civita_minor(a, b, c, 0, 1, 3), - levi_civita_minor(a, b, c, 0, 1, 2));
+    };
+
+    // ---------------------------------------------------------------------------
+    // Slashed vector a_mu gamma^mu as a 4x4 dirac matrix
+    template<class A>
+    inline void slash(const vector_expression<A> & x, std::complex<double> out[4][4])
+    {
+        const lorentz_vector a(x.lower());
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                out[i][j] = 0.;
+                for (int mu = 0; mu < 4; mu++)
+                {
+                    out[i][j] += a[mu] * GAMMA[mu][i][j];
+                }
+            }
+        }
+    };
+};
+
+#endif
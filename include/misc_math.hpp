@@ -12,6 +12,8 @@
 #include <iostream>
 #include <complex>
 #include <algorithm>
+#include <vector>
+#include <map>
 
 namespace jpacPhoto
 {
@@ -23,18 +25,39 @@ namespace jpacPhoto
 
     std::complex<double> cgamma(std::complex<double> z, int OPT = 0);
 
-    inline unsigned int factorial(unsigned int n) 
-    {
-        if (n == 0)
-        return 1;
-        return n * factorial(n - 1);
-    };
+    // Complex Gamma function (OPT = 0) or its log (OPT = 1) from the Lanczos approximation
+    std::complex<double> lanczos_gamma(std::complex<double> z, int OPT = 0);
+
+    // Same but for many arguments at once
+    void lanczos_gamma(const std::vector<std::complex<double>> & z, std::vector<std::complex<double>> & result, int OPT = 0);
+
+    // Energy dependence of a Regge propagator
+    // 1/2 (signature + exp(-i pi alpha)) Gamma(n - alpha) s^(alpha - m)
+    // The Gamma function and the power of s are combined in log space so the product
+    // stays finite and smooth for large |alpha| where each would separately overflow
+    std::complex<double> regge_factor(int signature, std::complex<double> alpha, int n, double s, int m = 0);
 
     // ---------------------------------------------------------------------------
+    // Tabulated coefficients
+    // The tables are filled once, the first time any of them is used (see misc_math.cpp),
+    // so at run-time every factorial, binomial, etc. is a single array lookup.
+
+    // n! as a double, finite up to 170!
+    const int FACTORIAL_MAX = 170;
+    double factorial(int n);
+
+    // Binomial coefficient (n choose k), tabulated for n <= BINOMIAL_MAX
+    const int BINOMIAL_MAX = 40;
+    double binomial(int n, int k);
+
     // Wigner d-func coefficient of leading power
+    // The magnitude only depends on j, M = max(|lam1|, |lam2|) and N = min(|lam1|, |lam2|)
+    // and is tabulated for integer j <= WIGNER_JMAX
+    const int WIGNER_JMAX = 10;
     double wigner_leading_coeff(int j, int lam1, int lam2);
 
     // Wigner d-function for half-integer spin
+    // j, lam1, lam2 are passed as 2 * j, 2 * lambda, 2 * lambda^prime
     double wigner_d_half(int j, int lam1, int lam2, double theta);
 
     // Wigner d-function for integer spin
@@ -42,6 +65,106 @@ namespace jpacPhoto
 
     // Wigner d-function for integer spin in terms of the cosine of theta not theta
     std::complex<double> wigner_d_int_cos(int j, int lam1, int lam2, double cos);
+
+    // ---------------------------------------------------------------------------
+    // Wigner d-functions for arbitrary spin.
+    // Every element is given in terms of a Jacobi polynomial
+    // d^j_{lam1 lam2}(theta) ~ sin^a(theta/2) cos^b(theta/2) P_k^{(a,b)}(cos theta)
+    // which is evaluated with the usual three-term recurrence in k.
+    //
+    // Integer and half-integer spin are treated the same by passing 2 * j, 2 * lambda
+    // as in wigner_d_half.
+
+    // Single element, evaluated on its own without the rest of the matrix
+    double wigner_d(int j, int lam1, int lam2, double theta);
+
+    // Single element for complex cos(theta), e.g. analytically continued to the t-channel
+    std::complex<double> wigner_d_cos(int j, int lam1, int lam2, std::complex<double> cos);
+
+    // The whole (2j + 1) x (2j + 1) matrix of d^j_{lam1 lam2}(theta).
+    // update() only recalculates if the angle has changed
+    class wigner_d_matrix
+    {
+        public:
+
+        // Constructor, j passed as 2 * j
+        wigner_d_matrix(int j);
+
+        // Recalculate all elements at a new angle
+        void update(double theta);
+
+        // Access an element, helicities passed as 2 * lambda
+        inline double operator()(int lam1, int lam2) const
+        {
+            return _d[index(lam1) * _n + index(lam2)];
+        };
+
+        // Matrices at many angles at once where the recurrence runs over all angles
+        // in the innermost loop.
+        // Output is ordered as result[(index(lam1) * (2j+1) + index(lam2)) * N + i] for N angles
+        void evaluate(const std::vector<double> & thetas, std::vector<double> & result) const;
+
+        inline int get_j(){ return _j; };
+
+        private:
+
+        int _j, _n; // 2 * j and 2 * j + 1
+
+        // lam = j, j - 1, ..., -j  ->  0, 1, ..., 2j
+        inline int index(int lam) const { return (_j - lam) / 2; };
+
+        double _cached_theta = 0.;
+        bool _empty = true;
+        std::vector<double> _d;
+    };
+
+    // ---------------------------------------------------------------------------
+    // Interpolated d-functions for fast repeated evaluation, e.g. when weighting MC events.
+    // With z = cos(theta) every element is split as
+    // d^j_{lam1 lam2}(z) = sin^a(theta/2) cos^b(theta/2) r(z)
+    // and the smooth reduced function r(z) = norm * P_k^{(a,b)}(z) is tabulated with its
+    // derivative on a uniform grid in z and evaluated by cubic Hermite interpolation.
+    // The half-angle factors are powers of sqrt((1 -+ z)/2) so no trig functions are needed.
+    //
+    // The grid is refined until the largest error of any element at the cell midpoints
+    // is below the tolerance or until the table would exceed the memory budget (in bytes).
+    class wigner_d_table
+    {
+        public:
+
+        // Constructor, j passed as 2 * j
+        wigner_d_table(int j, double tolerance = 1.E-8, int budget = 1000000);
+
+        // Single element at -1 <= z <= 1, helicities passed as 2 * lambda
+        double operator()(int lam1, int lam2, double z) const;
+
+        inline int get_j(){ return _j; };
+
+        // Number of grid points used and the largest error found when building the table
+        inline int get_nodes(){ return _N; };
+        inline double get_error(){ return _error; };
+
+        private:
+
+        int _j, _n; // 2 * j and 2 * j + 1
+
+        // Powers of the half angles for each element [index(lam1) * _n + index(lam2)]
+        std::vector<int> _a, _b;
+
+        // Grid of N points with spacing h
+        int _N = 0;
+        double _h = 0., _error = 0.;
+
+        // r(z) and r'(z) at each node, ordered as [(element * _N + node) * 2 + {0, 1}]
+        std::vector<double> _table;
+
+        // Fill the table on a grid of N points
+        void fill(int N);
+
+        // Interpolated reduced function and half-angle factors
+        double interpolate(int element, double z) const;
+        double half_angles(int element, double z) const;
+    };
 };
 
 #endif
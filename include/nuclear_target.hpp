@@ -0,0 +1,57 @@
+// Registry of nuclear targets with the parameters of their Fermi model charge distributions
+// used for e.g. Primakoff production
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+// References:
+// [1] arXiv:2008.01001 [hep-ph]
+// ---------------------------------------------------------------------------
+
+#ifndef _NUCLEAR_TARGET_
+#define _NUCLEAR_TARGET_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <cstdlib>
+
+// ---------------------------------------------------------------------------
+// nuclear_target holds everything needed to set up a nucleus as the target
+// in reaction_kinematics and primakoff_effect.
+//
+// Known targets are looked up by name, e.g. nuclear_target::get("U238")
+// and new ones (or different parameters for a known one) added with
+// nuclear_target::add({"Pb208", "^{208}Pb", 82, 208, mass, radius, skin});
+// ---------------------------------------------------------------------------
+
+namespace jpacPhoto
+{
+    struct nuclear_target
+    {
+        std::string _name;  // key in the registry
+        std::string _label; // label for plots
+        int _Z;             // atomic number
+        int _A;             // number of nucleons
+        double _mass;       // mass of the nucleus in GeV
+        double _radius;     // radius parameter of the charge distribution in GeV^-1
+        double _skin;       // skin thickness of the charge distribution in GeV^-1
+
+        // Get a saved target
+        static nuclear_target get(std::string name);
+
+        // Save a new target
+        static void add(nuclear_target target);
+
+        // Names of all saved targets
+        static std::vector<std::string> list();
+
+        private:
+
+        static std::map<std::string, nuclear_target> & registry();
+    };
+};
+
+#endif
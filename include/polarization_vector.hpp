@@ -36,6 +36,13 @@ namespace jpacPhoto
         std::complex<double> component(int i, int lambda, double s, double theta);
         std::complex<double> conjugate_component(int i, int lambda, double s, double theta);
 
+        // All components at once
+        lorentz_vector vector(int lambda, double s, double theta);
+        inline lorentz_vector conjugate_vector(int lambda, double s, double theta)
+        {
+            return vector(lambda, s, theta).conjugate();
+        };
+
         inline std::complex<double> field_tensor(int i, int j, int lambda, double s, double theta)
         {
             std::complex<double> result;
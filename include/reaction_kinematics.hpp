@@ -17,6 +17,7 @@
 #include "misc_math.hpp"
 #include "two_body_state.hpp"
 #include "dirac_spinor.hpp"
+#include "spinor_bilinear.hpp"
 #include "polarization_vector.hpp"
 #include "helicities.hpp"
 
@@ -49,6 +50,8 @@ namespace jpacPhoto
             _final_state     = new two_body_state(0., M2_PROTON);
             _eps_vec         = new polarization_vector(_final_state);
             _recoil          = new dirac_spinor(_final_state);
+
+            _bilinears       = new spinor_bilinear(_target, _recoil);
         };
 
         // Constructor with a set mX and JP
@@ -64,6 +67,8 @@ namespace jpacPhoto
             _final_state     = new two_body_state(mX*mX, M2_PROTON);
             _eps_vec         = new polarization_vector(_final_state);
             _recoil          = new dirac_spinor(_final_state);
+
+            _bilinears       = new spinor_bilinear(_target, _recoil);
         };
 
 
@@ -80,6 +85,8 @@ namespace jpacPhoto
             _final_state     = new two_body_state(mX*mX, mR*mR);
             _eps_vec         = new polarization_vector(_final_state);
             _recoil          = new dirac_spinor(_final_state);
+
+            _bilinears       = new spinor_bilinear(_target, _recoil);
         };
 
         // Constructor with a set mV and baryon mass mR
@@ -97,6 +104,8 @@ namespace jpacPhoto
             _final_state     = new two_body_state(mX*mX, mR*mR);
             _eps_vec         = new polarization_vector(_final_state);
             _recoil          = new dirac_spinor(_final_state);
+
+            _bilinears       = new spinor_bilinear(_target, _recoil);
         };
 
         // destructor
@@ -108,6 +117,7 @@ namespace jpacPhoto
             delete _eps_vec;
             delete _target;
             delete _recoil;
+            delete _bilinears;
         }
 
         // ---------------------------------------------------------------------------
@@ -171,6 +181,9 @@ namespace jpacPhoto
         polarization_vector * _eps_vec, * _eps_gamma;
         dirac_spinor * _target, * _recoil;
 
+        // Nucleon currents built from the target and recoil spinors above
+        spinor_bilinear * _bilinears;
+
         // Get s-channel scattering angle from invariants
         inline double z_s(double s, double t)
         {
@@ -236,6 +249,17 @@ namespace jpacPhoto
             return qRec_mu - qGamma_mu;
         };
 
+        // Or as full four-vectors
+        inline lorentz_vector t_exchange_momentum(double s, double theta)
+        {
+            return _initial_state->q(s, 0.) - _final_state->q(s, theta);
+        };
+
+        inline lorentz_vector u_exchange_momentum(double s, double theta)
+        {
+            return _final_state->p(s, theta + PI) - _initial_state->q(s, PI);
+        };
+
         
     };
 };
@@ -12,6 +12,9 @@
 
 #include <complex>
 #include <string>
+#include <vector>
+#include <functional>
+#include <cmath>
 
 class regge_trajectory
 {
@@ -36,10 +39,36 @@ class regge_trajectory
 
     virtual std::complex<double> slope(double s = 0.){return 0.;};
 
+    // Evaluate on a whole grid of s at once.
+    // By default these call the above at each point but derived classes can override them
+    // to calculate pieces shared by all points only once.
+    // Derived classes need a using declaration to keep these visible next to their own eval(double)
+    virtual void eval(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.resize(s.size());
+        for (int i = 0; i < s.size(); i++) result[i] = eval(s[i]);
+    };
+
+    virtual void slope(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.resize(s.size());
+        for (int i = 0; i < s.size(); i++) result[i] = slope(s[i]);
+    };
+
     // These parameters define the trajectory
     // name, spin, and mass of the lowest lying resonance on the parent trajectory
     std::string _parent;
     int _signature;
+
+    // Counts changes of the parameters so amplitudes which save anything calculated
+    // from the trajectory know when to recalculate.
+    // Setters in derived classes should call params_changed()
+    inline int version(){ return _version; };
+
+    protected:
+
+    int _version = 0;
+    inline void params_changed(){ _version++; };
 };
 
 
@@ -72,6 +101,7 @@ class linear_trajectory : public regge_trajectory
     void set_params(double inter, double slope)
     {
         _a0 = inter; _aprime = slope;
+        params_changed();
     };
 
     std::complex<double> eval(double s)
@@ -83,6 +113,146 @@ class linear_trajectory : public regge_trajectory
     {
         return _aprime;
     };
+
+    // Batch evaluation without a virtual call per point
+    using regge_trajectory::eval;
+    using regge_trajectory::slope;
+    void eval(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.resize(s.size());
+        for (int i = 0; i < s.size(); i++) result[i] = _a0 + _aprime * s[i];
+    };
+
+    void slope(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.assign(s.size(), _aprime);
+    };
+};
+
+// ---------------------------------------------------------------------------
+// Square-root trajectory
+// alpha(s) = alpha(0) + gamma * (sqrt(s_th) - sqrt(s_th - s))
+// which is real below the threshold s_th and develops a positive imaginary part above it.
+// This is the simplest trajectory with the right threshold behavior and
+// grows like sqrt(-s) for large negative s instead of linearly.
+class sqrt_trajectory : public regge_trajectory
+{
+    private:
+
+    // Intercept, strength of the square root and threshold
+    double _a0, _gamma, _sth;
+    double _sqrt_sth;
+
+    // sqrt(s_th - s) approached from above the real axis
+    inline std::complex<double> root(double s)
+    {
+        return (s < _sth) ? std::complex<double>(sqrt(_sth - s), 0.) : std::complex<double>(0., - sqrt(s - _sth));
+    };
+
+    public:
+
+    // Parameterized constructor
+    sqrt_trajectory(int sig, double inter, double gamma, double sth, std::string name = "")
+    : regge_trajectory(sig, name),
+      _a0(inter), _gamma(gamma), _sth(sth), _sqrt_sth(sqrt(sth))
+    {};
+
+    // copy Constructor
+    sqrt_trajectory(const sqrt_trajectory & old)
+    : regge_trajectory(old),
+      _a0(old._a0), _gamma(old._gamma), _sth(old._sth), _sqrt_sth(old._sqrt_sth)
+    {};
+
+    // Setting utility
+    void set_params(double inter, double gamma, double sth)
+    {
+        _a0 = inter; _gamma = gamma; _sth = sth;
+        _sqrt_sth = sqrt(sth);
+        params_changed();
+    };
+
+    std::complex<double> eval(double s)
+    {
+        return _a0 + _gamma * (_sqrt_sth - root(s));
+    };
+
+    std::complex<double> slope(double s = 0.)
+    {
+        return _gamma / (2. * root(s));
+    };
+
+    using regge_trajectory::eval;
+    using regge_trajectory::slope;
+    void eval(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.resize(s.size());
+        double a = _a0 + _gamma * _sqrt_sth;
+        for (int i = 0; i < s.size(); i++) result[i] = a - _gamma * root(s[i]);
+    };
+
+    void slope(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+    {
+        result.resize(s.size());
+        for (int i = 0; i < s.size(); i++) result[i] = _gamma / (2. * root(s[i]));
+    };
+};
+
+// ---------------------------------------------------------------------------
+// Dispersive (complex) trajectory
+// The real part is given by a once-subtracted dispersion relation over a user-supplied imaginary part
+// alpha(s) = alpha(0) + alpha' s + s / pi * int_{s_th}^{inf} ds' Im alpha(s') / (s' (s' - s))
+// Im alpha(s') needs to fall faster than s' for the integral to converge.
+//
+// Every evaluation requires an integral so the batch evaluation saves the trajectory
+// on the last grid passed to it and later single-point calls on that grid are looked up.
+class dispersive_trajectory : public regge_trajectory
+{
+    private:
+
+    // Subtraction constants and threshold
+    double _a0, _aprime, _sth;
+
+    // Imaginary part along the cut
+    std::function<double(double)> _imag;
+
+    // Dispersive integral with principal value above threshold
+    std::complex<double> dispersive_integral(double s);
+    double dispersive_derivative(double s);
+
+    // Values saved on the last grid
+    std::vector<double> _grid;
+    std::vector<std::complex<double>> _saved_alpha, _saved_slope;
+    int find(double s);
+
+    public:
+
+    // Parameterized constructor
+    dispersive_trajectory(int sig, double inter, double slope, double sth, std::function<double(double)> imag, std::string name = "")
+    : regge_trajectory(sig, name),
+      _a0(inter), _aprime(slope), _sth(sth), _imag(imag)
+    {};
+
+    // copy Constructor
+    dispersive_trajectory(const dispersive_trajectory & old)
+    : regge_trajectory(old),
+      _a0(old._a0), _aprime(old._aprime), _sth(old._sth), _imag(old._imag)
+    {};
+
+    // Setting utility
+    void set_params(double inter, double slope, double sth, std::function<double(double)> imag)
+    {
+        _a0 = inter; _aprime = slope; _sth = sth; _imag = imag;
+        _grid.clear(); _saved_alpha.clear(); _saved_slope.clear();
+        params_changed();
+    };
+
+    std::complex<double> eval(double s);
+    std::complex<double> slope(double s = 0.);
+
+    using regge_trajectory::eval;
+    using regge_trajectory::slope;
+    void eval(const std::vector<double> & s, std::vector<std::complex<double>> & result);
+    void slope(const std::vector<double> & s, std::vector<std::complex<double>> & result);
 };
 
 #endif
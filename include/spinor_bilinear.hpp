@@ -0,0 +1,154 @@
+// Bilinears of the target and recoil nucleon spinors, ubar(recoil) Γ u(target),
+// evaluated for all four helicity combinations at once from cached spinors.
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#ifndef _BILINEAR_
+#define _BILINEAR_
+
+#include <complex>
+
+#include "constants.hpp"
+#include "gamma_matrices.hpp"
+#include "lorentz_vector.hpp"
+#include "dirac_spinor.hpp"
+
+// ---------------------------------------------------------------------------
+// The spinor_bilinear object caches the components of the target and recoil
+// spinors for both helicities at a given s and theta and uses them to
+// build the nucleon currents needed at the bottom vertex of t-channel amplitudes,
+// or the spinor rows/columns needed for u-channel exchanges.
+//
+// Target is oriented at theta = pi and recoil at theta + pi as in all amplitudes.
+// Helicities are passed as +-1 (i.e. 2 x lambda) like everywhere else.
+//
+// Since both nucleons move in the x-z plane, the scalar, pseudoscalar, vector
+// and momentum-transfer tensor currents are also available in closed form in terms
+// of the half-angle factors and omega_pm = sqrt(E pm m) of each spinor.
+// Which method is used is chosen with set_mode():
+// 0 - numeric contraction of the 4x4 dirac matrices
+// 1 - closed-form expressions (default)
+// 2 - both, with a warning printed if they disagree
+// ---------------------------------------------------------------------------
+
+namespace jpacPhoto
+{
+    class spinor_bilinear
+    {
+        public:
+
+        // Constructor
+        spinor_bilinear(dirac_spinor * target, dirac_spinor * recoil)
+        : _target(target), _recoil(recoil)
+        {};
+
+        // Choose between numeric and closed-form currents
+        inline void set_mode(int i)
+        {
+            if (i < 0 || i > 2)
+            {
+                std::cout << "\nspinor_bilinear: Invalid mode " << i << " passed to set_mode! Using closed-form currents.\n";
+                i = 1;
+            }
+            _mode = i; _empty = true;
+        };
+
+        // Recalculate cached spinors only if kinematics have changed
+        void update(double s, double theta);
+
+        // Cached components of the target spinor and recoil adjoint spinor
+        inline std::complex<double> spinor(int i, int lam_targ)
+        {
+            fill_spinors();
+            return _u[index(lam_targ)][i];
+        };
+        inline std::complex<double> adjoint_spinor(int i, int lam_rec)
+        {
+            fill_spinors();
+            return _ubar[index(lam_rec)][i];
+        };
+
+        // ubar(recoil) M u(target) for an arbitrary 4x4 dirac matrix M
+        std::complex<double> contract(const std::complex<double> M[4][4], int lam_targ, int lam_rec);
+
+        // Row vector ubar(recoil) M and column vector M u(target)
+        void row(const std::complex<double> M[4][4], int lam_rec, std::complex<double> out[4]);
+        void column(const std::complex<double> M[4][4], int lam_targ, std::complex<double> out[4]);
+
+        // ubar gamma^mu u
+        inline lorentz_vector vector_current(int lam_targ, int lam_rec)
+        {
+            return _vector[index(lam_targ)][index(lam_rec)];
+        };
+
+        // ubar sigma^{mu nu} q_nu u for given four-vector q^nu
+        lorentz_vector tensor_current(const lorentz_vector & q, int lam_targ, int lam_rec);
+
+        // ubar sigma^{mu nu} q_nu u with q the momentum transfer (p_rec - p_targ)
+        lorentz_vector tensor_current(int lam_targ, int lam_rec);
+
+        // ubar u
+        inline std::complex<double> scalar_current(int lam_targ, int lam_rec)
+        {
+            return _scalar[index(lam_targ)][index(lam_rec)];
+        };
+
+        // ubar gamma_5 u
+        inline std::complex<double> pseudoscalar_current(int lam_targ, int lam_rec)
+        {
+            return _pseudoscalar[index(lam_targ)][index(lam_rec)];
+        };
+
+        // ubar a-slashed u for given four-vector a^mu
+        inline std::complex<double> slashed_current(const lorentz_vector & a, int lam_targ, int lam_rec)
+        {
+            return jpacPhoto::contract(a, _vector[index(lam_targ)][index(lam_rec)]);
+        };
+
+        private:
+
+        dirac_spinor * _target, * _recoil;
+
+        // 0 - numeric, 1 - closed-form, 2 - cross-check
+        int _mode = 1;
+
+        // Helicity +-1 -> array index 1, 0
+        inline int index(int lam){ return (lam + 1) / 2; };
+
+        // Saved kinematics the spinors were calculated at
+        // masses of both states are saved since e.g. mX or Q2 may be changed externally
+        double _cached_s = 0., _cached_theta = 0.;
+        double _cached_masses[4] = {0., 0., 0., 0.};
+        bool _empty = true;
+
+        // Spinor components [helicity][component]
+        // only filled when components are actually needed
+        std::complex<double> _u[2][4], _ubar[2][4];
+        bool _spinors_empty = true;
+        void fill_spinors();
+
+        // Currents from explicit 4x4 contractions or closed-form expressions
+        void calculate_numeric();
+        void calculate_analytic();
+        void compare_numeric();
+
+        // p_rec + p_targ and m_rec + m_targ entering the Gordon identity
+        lorentz_vector _p_sum;
+        double _m_sum = 0.;
+
+        // Currents [lam_targ][lam_rec]
+        lorentz_vector _vector[2][2];
+        std::complex<double> _scalar[2][2], _pseudoscalar[2][2];
+
+        // Tensor current is saved along with the vector it was contracted with
+        lorentz_vector _tensor_q;
+        lorentz_vector _tensor[2][2];
+        bool _tensor_empty = true;
+        void calculate_tensor(const lorentz_vector & q);
+    };
+};
+
+#endif
@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include "misc_math.hpp"
+#include "lorentz_vector.hpp"
 
 // ---------------------------------------------------------------------------
 // The two_body_state is the base object for defining a reaction in the
@@ -91,6 +92,10 @@ namespace jpacPhoto
         // Full 4-momenta 
         std::complex<double> q(int mu, double s, double theta); // 4vector of vector, particle 1
         std::complex<double> p(int mu, double s, double theta); // 4vector of baryon, particle 2
+
+        // Or all components at once
+        lorentz_vector q(double s, double theta);
+        lorentz_vector p(double s, double theta);
     };
 };
 
@@ -14,8 +14,81 @@ std::complex<double> jpacPhoto::amplitude_sum::helicity_amplitude(std::array<int
     std::complex<double> result = 0.;
     for (int i = 0; i < _amps.size(); i++)
     {
-        result += _amps[i]->helicity_amplitude(helicities, s, t);
+        result += term_amplitude(i, helicities, s, t);
     }
 
     return result;
 };
+
+// Amplitude of a single term for given set of helicities, taken from its cached amplitudes if possible
+std::complex<double> jpacPhoto::amplitude_sum::term_amplitude(int i, std::array<int, 4> helicities, double s, double t)
+{
+    // Position of the helicities in the cached amplitudes
+    std::vector<std::array<int, 4>> & helicities_i = _amps[i]->_kinematics->_helicities;
+    std::vector<std::array<int, 4>>::iterator entry = std::find(helicities_i.begin(), helicities_i.end(), helicities);
+
+    if (entry == helicities_i.end())
+    {
+        return _amps[i]->helicity_amplitude(helicities, s, t);
+    }
+
+    _amps[i]->check_cache(s, t);
+    return _amps[i]->_cached_helicity_amplitude[entry - helicities_i.begin()];
+};
+
+// Sum of all helicity amplitudes of each term, only recalculated if out of date
+void jpacPhoto::amplitude_sum::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+{
+    result.assign(_kinematics->_nAmps, 0.);
+
+    for (int i = 0; i < _amps.size(); i++)
+    {
+        // Terms with their own kinematics may have different helicities or order them differently
+        if (_amps[i]->_kinematics != _kinematics)
+        {
+            for (int j = 0; j < result.size(); j++)
+            {
+                result[j] += term_amplitude(i, _kinematics->_helicities[j], s, t);
+            }
+            continue;
+        }
+
+        _amps[i]->check_cache(s, t);
+        for (int j = 0; j < result.size(); j++)
+        {
+            result[j] += _amps[i]->_cached_helicity_amplitude[j];
+        }
+    }
+};
+
+// Same on a grid of t
+void jpacPhoto::amplitude_sum::helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result)
+{
+    result.assign(t.size(), std::vector<std::complex<double>>(_kinematics->_nAmps, 0.));
+
+    std::vector<std::vector<std::complex<double>>> amps_i;
+    for (int i = 0; i < _amps.size(); i++)
+    {
+        // As above, terms with their own kinematics are added one helicity at a time
+        if (_amps[i]->_kinematics != _kinematics)
+        {
+            for (int k = 0; k < t.size(); k++)
+            {
+                for (int j = 0; j < result[k].size(); j++)
+                {
+                    result[k][j] += term_amplitude(i, _kinematics->_helicities[j], s, t[k]);
+                }
+            }
+            continue;
+        }
+
+        _amps[i]->helicity_amplitudes(s, t, amps_i);
+        for (int k = 0; k < t.size(); k++)
+        {
+            for (int j = 0; j < result[k].size(); j++)
+            {
+                result[k][j] += amps_i[k][j];
+            }
+        }
+    }
+};
@@ -15,16 +15,117 @@ std::complex<double> jpacPhoto::baryon_resonance::helicity_amplitude(std::array<
 
     // update save values of energies and angle
     _s = s; _t = t; _theta = _kinematics->theta_s(s, t);
+    update_s_factors();
+    update_wigner(_kinematics->z_s(s, t));
 
     std::complex<double> residue = 1.;
     residue  = photo_coupling(lam_i);
     residue *= hadronic_coupling(lam_f);
-    residue *= threshold_factor(1.5);
+    residue *= _wigner[(lam_i + 3) / 2][(lam_f + 3) / 2];
 
-    residue *= wigner_d_half(_resJ, lam_i, lam_f, _theta);
-    residue /= (s + XI * _mRes * _gamRes - _mRes*_mRes);
+    return residue * _pole;
+};
+
+// ---------------------------------------------------------------------------
+// All helicity amplitudes at a single point
+void jpacPhoto::baryon_resonance::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+{
+    _s = s; _t = t; _theta = _kinematics->theta_s(s, t);
+    update_s_factors();
+    update_wigner(_kinematics->z_s(s, t));
+
+    fill_helicity_amplitudes(result);
+};
+
+// and on a grid of s at fixed angle
+void jpacPhoto::baryon_resonance::lineshape(const std::vector<double> & s, double theta, std::vector<std::vector<std::complex<double>>> & result)
+{
+    update_wigner(cos(theta));
+
+    // Breit-Wigner for the whole grid
+    std::vector<std::complex<double>> bw;
+    breit_wigner(s, bw);
+
+    result.resize(s.size());
+    for (int i = 0; i < s.size(); i++)
+    {
+        _s = s[i]; _t = _kinematics->t_man(s[i], theta); _theta = theta;
+        update_s_factors(bw[i]);
+
+        fill_helicity_amplitudes(result[i]);
+    }
+};
+
+void jpacPhoto::baryon_resonance::fill_helicity_amplitudes(std::vector<std::complex<double>> & result)
+{
+    // Couplings for each lam_i and lam_f
+    std::complex<double> photo[4], hadronic[4];
+    for (int lam = -3; lam <= 3; lam += 2)
+    {
+        photo[(lam + 3) / 2]    = photo_coupling(lam);
+        hadronic[(lam + 3) / 2] = hadronic_coupling(lam);
+    }
+
+    result.resize(_kinematics->_nAmps);
+    for (int i = 0; i < _kinematics->_nAmps; i++)
+    {
+        std::array<int, 4> hel = _kinematics->_helicities[i];
+        int a = (2 * hel[0] - hel[1] + 3) / 2;
+        int b = (2 * hel[2] - hel[3] + 3) / 2;
+
+        result[i] = photo[a] * hadronic[b] * _wigner[a][b] * _pole;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Breit-Wigner pole
+void jpacPhoto::baryon_resonance::breit_wigner(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+{
+    result.resize(s.size());
+    for (int i = 0; i < s.size(); i++)
+    {
+        result[i] = breit_wigner(s[i]);
+    }
+};
+
+// Everything which depends on s but not on helicities or angle
+void jpacPhoto::baryon_resonance::update_s_factors()
+{
+    if (_s == _saved_s && _kinematics->_mX2 == _saved_mX2 && _kinematics->_mB2 == _saved_mB2) return;
+
+    update_s_factors(breit_wigner(_s));
+};
+
+void jpacPhoto::baryon_resonance::update_s_factors(std::complex<double> bw)
+{
+    // s dependence of the photo-coupling
+    _photo_s  = sqrt(XR * _s) * _pibar / _mRes;
+    _photo_s *= sqrt(XR * 8. * M_PROTON * _mRes / _kinematics->_initial_state->momentum(_s));
+
+    // and of the hadronic coupling
+    _hadronic_s = pow(_kinematics->_final_state->momentum(_s), _lmin);
+
+    // threshold factor and pole
+    _pole  = threshold_factor(1.5);
+    _pole *= bw;
+
+    _saved_s = _s; _saved_mX2 = _kinematics->_mX2; _saved_mB2 = _kinematics->_mB2;
+};
 
-    return residue;
+// d-functions at the angle with cosine z
+void jpacPhoto::baryon_resonance::update_wigner(std::complex<double> z)
+{
+    if (z == _saved_z) return;
+
+    for (int lam_i = -3; lam_i <= 3; lam_i += 2)
+    {
+        for (int lam_f = -3; lam_f <= 3; lam_f += 2)
+        {
+            _wigner[(lam_i + 3) / 2][(lam_f + 3) / 2] = (std::max(std::abs(lam_i), std::abs(lam_f)) > _resJ) ? 0. : d_function(_resJ, lam_i, lam_f, z);
+        }
+    }
+
+    _saved_z = z;
 };
 
 // Ad-hoc threshold factor to kill the resonance at threshold
@@ -36,16 +137,10 @@ double jpacPhoto::baryon_resonance::threshold_factor(double beta)
     return result;
 };
 
-// Photoexcitation helicity amplitude for the process gamma p -> R
-std::complex<double> jpacPhoto::baryon_resonance::photo_coupling(int lam_i)
+// ---------------------------------------------------------------------------
+// Energy independent parts of the couplings
+void jpacPhoto::baryon_resonance::update_couplings()
 {
-    // For spin-1/2 exchange no double flip
-    if (_resJ == 1 && abs(lam_i) > 1) return 0.;
-
-    // A_1/2 or A_3/2 depending on ratio R_photo
-    double a;
-    (std::abs(lam_i) == 1) ? (a = _photoR) : (a = sqrt(1. - _photoR * _photoR));
-
     // Electromagnetic decay width given by VMD assumption
     std::complex<double> emGamma = (_xBR * _gamRes) * pow(F_JPSI / M_JPSI, 2.);
     emGamma *= pow(XR * _pibar / _pfbar, double(2 * _lmin + 1)) * _pt;
@@ -54,28 +149,34 @@ std::complex<double> jpacPhoto::baryon_resonance::photo_coupling(int lam_i)
     std::complex<double> A_lam = emGamma * PI * _mRes * double(_resJ + 1) / (2. * M_PROTON * _pibar * _pibar);
     A_lam = sqrt(XR * A_lam);
 
-    std::complex<double> result = sqrt(XR * _s) * _pibar / _mRes;
-    result *= sqrt(XR * 8. * M_PROTON * _mRes / _kinematics->_initial_state->momentum(_s));
-    result *= A_lam * a;
-
     // FACTOR OF 4 PI SOMETIMES FACTORED OUT
-    result *= sqrt(4. * PI * ALPHA);
+    A_lam *= sqrt(4. * PI * ALPHA);
 
-    return result;
-};
+    // A_1/2 or A_3/2 depending on ratio R_photo
+    _photo_norm[0] = A_lam * _photoR;
+    _photo_norm[1] = A_lam * sqrt(1. - _photoR * _photoR);
 
-// Hadronic decay helicity amplitude for the R -> J/psi p process
-std::complex<double> jpacPhoto::baryon_resonance::hadronic_coupling(int lam_f)
-{
     // Hadronic coupling constant g, given in terms of branching ratio xBR
     std::complex<double> g;
     g  = 8. * PI * _xBR * _gamRes;
     g *=  _mRes * _mRes * double(_resJ + 1) / 6.;
     g /= pow(_pfbar, double(2 * _lmin + 1));
-    g = sqrt(XR * g);
+    _hadronic_norm = sqrt(XR * g);
+};
 
-    std::complex<double> gpsi;
-    gpsi = g * pow(_kinematics->_final_state->momentum(_s), _lmin);
+// Photoexcitation helicity amplitude for the process gamma p -> R
+std::complex<double> jpacPhoto::baryon_resonance::photo_coupling(int lam_i)
+{
+    // For spin-1/2 exchange no double flip
+    if (_resJ == 1 && abs(lam_i) > 1) return 0.;
+
+    return _photo_norm[(std::abs(lam_i) - 1) / 2] * _photo_s;
+};
+
+// Hadronic decay helicity amplitude for the R -> J/psi p process
+std::complex<double> jpacPhoto::baryon_resonance::hadronic_coupling(int lam_f)
+{
+    std::complex<double> gpsi = _hadronic_norm * _hadronic_s;
 
     (lam_f < 0) ? (gpsi *= double(_naturality)) : (gpsi *= 1.);
 
@@ -16,21 +16,18 @@ std::complex<double> jpacPhoto::dirac_exchange::helicity_amplitude(std::array<in
     int lam_vec = helicities[2];
     int lam_rec = helicities[3];
 
-    // Store the invariant energies to avoid having to pass them around 
-    _s = s; _t = t, _theta = _kinematics->theta_s(s, t);
-    _u = _kinematics->u_man(s, _theta);
+    update_kinematics(s, t);
+
+    std::complex<double> top[4], bottom[4];
+    top_vertex(lam_gam, lam_rec, top);
+    bottom_vertex(lam_vec, lam_targ, bottom);
 
     std::complex<double> result = 0.;
     for (int i = 0; i < 4; i++)
     {
         for (int j = 0; j < 4; j++)
         {
-            std::complex<double> temp;
-            temp  = top_vertex(i, lam_gam, lam_rec);
-            temp *= dirac_propagator(i, j);
-            temp *= bottom_vertex(j, lam_vec, lam_targ);
-
-            result += temp;
+            result += top[i] * _propagator[i][j] * bottom[j];
         }
     }
     
@@ -39,6 +36,64 @@ std::complex<double> jpacPhoto::dirac_exchange::helicity_amplitude(std::array<in
     return result;
 };
 
+//------------------------------------------------------------------------------
+// All helicity amplitudes at once
+void jpacPhoto::dirac_exchange::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+{
+    update_kinematics(s, t);
+
+    // Rows of the top vertex [lam_gam][lam_rec]
+    std::complex<double> top[2][2][4];
+    for (int lam_gam = -1; lam_gam <= 1; lam_gam += 2)
+    {
+        for (int lam_rec = -1; lam_rec <= 1; lam_rec += 2) top_vertex(lam_gam, lam_rec, top[(lam_gam + 1) / 2][(lam_rec + 1) / 2]);
+    }
+
+    // Columns of the bottom vertex already multiplied by the propagator [lam_vec + 1][lam_targ]
+    std::complex<double> bottom[3][2][4];
+    int j = _kinematics->_jp[0];
+    for (int lam_vec = -j; lam_vec <= j; lam_vec++)
+    {
+        for (int lam_targ = -1; lam_targ <= 1; lam_targ += 2)
+        {
+            std::complex<double> column[4];
+            bottom_vertex(lam_vec, lam_targ, column);
+
+            std::complex<double> * propagated = bottom[lam_vec + 1][(lam_targ + 1) / 2];
+            for (int a = 0; a < 4; a++)
+            {
+                propagated[a] = 0.;
+                for (int b = 0; b < 4; b++) propagated[a] += _propagator[a][b] * column[b];
+            }
+        }
+    }
+
+    std::complex<double> ff = form_factor();
+
+    result.resize(_kinematics->_nAmps);
+    for (int i = 0; i < _kinematics->_nAmps; i++)
+    {
+        std::array<int, 4> hel = _kinematics->_helicities[i];
+        std::complex<double> * row    = top[(hel[0] + 1) / 2][(hel[3] + 1) / 2];
+        std::complex<double> * column = bottom[hel[2] + 1][(hel[1] + 1) / 2];
+
+        result[i] = 0.;
+        for (int a = 0; a < 4; a++) result[i] += row[a] * column[a];
+        result[i] *= ff;
+    }
+};
+
+//------------------------------------------------------------------------------
+// Everything which only depends on the kinematics
+void jpacPhoto::dirac_exchange::update_kinematics(double s, double t)
+{
+    // Store the invariant energies to avoid having to pass them around 
+    _s = s; _t = t, _theta = _kinematics->theta_s(s, t);
+    _u = _kinematics->u_man(s, _theta);
+    _kinematics->_bilinears->update(s, _theta);
+    update_propagator();
+};
+
 double jpacPhoto::dirac_exchange::form_factor()
 {
     switch (_useFF)
@@ -66,141 +121,85 @@ double jpacPhoto::dirac_exchange::form_factor()
 //------------------------------------------------------------------------------
 // Photon fermion fermion vertex
 // (ubar epsilon-slashed)
-std::complex<double> jpacPhoto::dirac_exchange::top_vertex(int i, int lam_gam, int lam_rec)
+void jpacPhoto::dirac_exchange::top_vertex(int lam_gam, int lam_rec, std::complex<double> row[4])
 {
     if (_scTOP == true)
     {
         // Scalar for testing purposes
-        return _gGam * _kinematics->_recoil->adjoint_component(i, lam_rec, _s, _theta + PI);
+        for (int i = 0; i < 4; i++) row[i] = _gGam * _kinematics->_bilinears->adjoint_spinor(i, lam_rec);
+        return;
     }
 
-    std::complex<double> result = 0.;
-    for (int k = 0; k < 4; k++)
-    {
-        std::complex<double> temp;
-        temp  = _kinematics->_recoil->adjoint_component(k, lam_rec, _s, _theta + PI); // theta_recoil = theta + pi
-        temp *= slashed_eps(k, i, lam_gam, _kinematics->_eps_gamma, false, _s, 0.); // theta_gamma = 0
+    // theta_gamma = 0, theta_recoil = theta + pi
+    std::complex<double> slashed_eps[4][4];
+    slash(_kinematics->_eps_gamma->vector(lam_gam, _s, 0.), slashed_eps);
+    _kinematics->_bilinears->row(slashed_eps, lam_rec, row);
 
-        result += temp;
-    }
-
-    return _gGam * result;
+    for (int i = 0; i < 4; i++) row[i] *= _gGam;
 };
 
 //------------------------------------------------------------------------------
 // Vector fermion fermion vertex
 // (epsilon*-slashed u)
-std::complex<double> jpacPhoto::dirac_exchange::bottom_vertex(int j, int lam_vec, int lam_targ)
+void jpacPhoto::dirac_exchange::bottom_vertex(int lam_vec, int lam_targ, std::complex<double> column[4])
 {
     if (_scBOT == true)
     {
         // Scalar for testing purposes
-        return _gVec * _kinematics->_target->component(j, lam_targ, _s , PI); // theta_target = pi
+        for (int j = 0; j < 4; j++) column[j] = _gVec * _kinematics->_bilinears->spinor(j, lam_targ); // theta_target = pi
+        return;
     }
 
-    std::complex<double> result = 0.;
-    
+    std::complex<double> M[4][4];
+
     // F - F - V coupling
     if (_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == -1)
     {
-        for (int k = 0; k < 4; k++)
-        {
-            std::complex<double> temp;
-            temp  = slashed_eps(j, k, lam_vec, _kinematics->_eps_vec, true, _s, _theta + PI); //theta_vec = theta
-            temp *= _kinematics->_target->component(k, lam_targ, _s, PI); // theta_target = pi
-
-            result += temp;
-        }
+        slash(_kinematics->_eps_vec->conjugate_vector(lam_vec, _s, _theta + PI), M); //theta_vec = theta
     }
 
     // F - F - P coupling
     else if (_kinematics->_jp[0] == 0 && _kinematics->_jp[1] == -1)
     {
-        for (int k = 0; k < 4; k++)
+        for (int i = 0; i < 4; i++)
         {
-            std::complex<double> temp;
-            temp  = XI * GAMMA_5[j][k];
-            temp *= _kinematics->_target->component(k, lam_targ, _s, PI); // theta_target = pi
-
-            result += temp;
+            for (int j = 0; j < 4; j++) M[i][j] = XI * GAMMA_5[i][j];
         }
     }
 
+    // theta_target = pi
+    _kinematics->_bilinears->column(M, lam_targ, column);
 
-    return _gVec * result;
+    for (int j = 0; j < 4; j++) column[j] *= _gVec;
 };
 
 //------------------------------------------------------------------------------
-double jpacPhoto::dirac_exchange::exchange_mass()
+// Propagator matrix, saved until the kinematics change
+void jpacPhoto::dirac_exchange::update_propagator()
 {
-    double result = 0.;
-    for (int mu = 0; mu < 4; mu++)
-    {
-        std::complex<double> temp;
-        temp  = _kinematics->u_exchange_momentum(mu, _s, _theta);
-        temp *= METRIC[mu];
-        temp *= _kinematics->u_exchange_momentum(mu, _s, _theta);
+    if (_s == _saved_s && _theta == _saved_theta && _kinematics->_mX2 == _saved_mX2 && _kinematics->_mB2 == _saved_mB2) return;
 
-        result += real(temp);
-    }
+    calculate_propagator();
 
-    return result;
-}
+    _saved_s = _s; _saved_theta = _theta; _saved_mX2 = _kinematics->_mX2; _saved_mB2 = _kinematics->_mB2;
+};
 
-std::complex<double> jpacPhoto::dirac_exchange::slashed_exchange_momentum(int i, int j)
+// Spin-1/2 propagator
+void jpacPhoto::dirac_exchange::calculate_propagator()
 {
-    std::complex<double> result = 0.;
-    for (int mu = 0; mu < 4; mu++)
-    {
-        std::complex<double> temp;
-        temp  = GAMMA[mu][i][j];
-        temp *= METRIC[mu];
-        temp *= _kinematics->u_exchange_momentum(mu, _s, _theta);
-
-        result += temp;
-    }
+    lorentz_vector q = _kinematics->u_exchange_momentum(_s, _theta);
 
-    return result;
-};
+    std::complex<double> slashed_q[4][4];
+    slash(q, slashed_q);
 
-//------------------------------------------------------------------------------
-// Slashed polarization vectors
-std::complex<double> jpacPhoto::dirac_exchange::slashed_eps(int i, int j, double lam, polarization_vector * eps, bool STAR, double s, double theta)
-{
-    std::complex<double> result = 0.;
-    for (int mu = 0; mu < 4; mu++)
+    double denominator = real(contract(q, q)) - _mEx2;
+    for (int i = 0; i < 4; i++)
     {
-        std::complex<double> temp;
-        if (STAR == false)
-        {
-            temp  = eps->component(mu, lam, s, theta);
-        }
-        else
+        for (int j = 0; j < 4; j++)
         {
-            temp = eps->conjugate_component(mu, lam, s, theta);
+            _propagator[i][j] = slashed_q[i][j];
+            if (i == j) _propagator[i][j] += _mEx;
+            _propagator[i][j] /= denominator;
         }
-        temp *= METRIC[mu];
-        temp *= GAMMA[mu][i][j];
-
-        result += temp;
     }
-
-    return result;
-};
-
-
-//------------------------------------------------------------------------------
-std::complex<double> jpacPhoto::dirac_exchange::dirac_propagator(int i, int j)
-{
-    std::complex<double> result;
-    result = slashed_exchange_momentum(i, j);
-
-    if (i == j)
-    {
-        result += _mEx;
-    }
-
-    result /= exchange_mass() - _mEx2;
-
-    return result;
 };
@@ -13,28 +13,71 @@
 void jpacPhoto::amplitude::check_cache(double s, double t)
 {
     // check if saved version its the one we want
-    if (  (abs(_cached_s - s) < 0.00001) && 
-          (abs(_cached_t - t) < 0.00001) &&
-          (abs(_cached_mX2 - _kinematics->_mX2) < 0.00001) // important to make sure the value of mX2 hasnt chanced since last time
+    if (  (_cached_s == s) && (_cached_t == t) &&
+          (_cached_mX2 == _kinematics->_mX2) && // important to make sure the masses
+          (_cached_mB2 == _kinematics->_mB2) && // and parameters havent changed since last time
+          (_cached_version == params_version())
        )
     {
         return; // do nothing
     }
     else // save a new set
     {
-        _cached_helicity_amplitude.clear();
-        for (int i = 0; i < _kinematics->_nAmps; i++)
-        {
-            _cached_helicity_amplitude.push_back(helicity_amplitude(_kinematics->_helicities[i], s, t));
-        };
+        helicity_amplitudes(s, t, _cached_helicity_amplitude);
 
         // update cache info
-        _cached_mX2 = _kinematics->_mX2; _cached_s = s; _cached_t = t;
+        _cached_mX2 = _kinematics->_mX2; _cached_mB2 = _kinematics->_mB2; _cached_s = s; _cached_t = t;
+        _cached_version = params_version();
     }
 
     return;
 };
 
+// ---------------------------------------------------------------------------
+// Default evaluation of all helicity amplitudes, one at a time
+void jpacPhoto::amplitude::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+{
+    result.resize(_kinematics->_nAmps);
+    for (int i = 0; i < _kinematics->_nAmps; i++)
+    {
+        result[i] = helicity_amplitude(_kinematics->_helicities[i], s, t);
+    }
+};
+
+// and one value of t at a time
+void jpacPhoto::amplitude::helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result)
+{
+    result.resize(t.size());
+    for (int i = 0; i < t.size(); i++)
+    {
+        helicity_amplitudes(s, t[i], result[i]);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Wigner d-function either exactly or from the saved interpolation tables
+std::complex<double> jpacPhoto::amplitude::d_function(int j, int lam1, int lam2, std::complex<double> z)
+{
+    // Outside the physical region use the analytic continuation
+    if (std::abs(imag(z)) > 0. || std::abs(real(z)) > 1.)
+    {
+        return wigner_d_cos(j, lam1, lam2, z);
+    }
+
+    if (_useWignerTables == false)
+    {
+        return wigner_d(j, lam1, lam2, TMath::ACos(real(z)));
+    }
+
+    std::map<int, wigner_d_table>::iterator entry = _wignerTables.find(j);
+    if (entry == _wignerTables.end())
+    {
+        entry = _wignerTables.insert(std::make_pair(j, wigner_d_table(j, _wignerTolerance, _wignerBudget))).first;
+    }
+
+    return entry->second(lam1, lam2, real(z));
+};
+
 // ---------------------------------------------------------------------------
 // Square of the spin averaged amplitude squared
 double jpacPhoto::amplitude::probability_distribution(double s, double t)
@@ -68,6 +111,31 @@ double jpacPhoto::amplitude::differential_xsection(double s, double t)
     return norm * sum;
 };
 
+// Same on a grid of t values, with all helicity amplitudes evaluated together
+std::vector<double> jpacPhoto::amplitude::differential_xsection(double s, const std::vector<double> & t)
+{
+    std::vector<std::vector<std::complex<double>>> amps;
+    helicity_amplitudes(s, t, amps);
+
+    double norm = 1.;
+    norm /= 64. * PI * s;
+    norm /= real(pow(_kinematics->_initial_state->momentum(s), 2.));
+    norm /= (2.56819E-6); // Convert from GeV^-2 -> nb
+    norm /= 4.; // Average over initial state helicites
+
+    std::vector<double> result(t.size(), 0.);
+    for (int i = 0; i < t.size(); i++)
+    {
+        for (int j = 0; j < amps[i].size(); j++)
+        {
+            result[i] += std::norm(amps[i][j]);
+        }
+        result[i] *= norm;
+    }
+
+    return result;
+};
+
 // ---------------------------------------------------------------------------
 // Inegrated total cross-section
 // IN NANOBARN
@@ -29,103 +29,221 @@ std::complex<double> jpacPhoto::pomeron_exchange::helicity_amplitude(std::array<
     }
 
     // else contract indices
-    for (int mu = 0; mu < 4; mu++)
-    {
-        std::complex<double> temp = 1.;
-        temp *= regge_factor();
-        temp *= top_vertex(mu, lam_gam, lam_vec);
-        temp *= METRIC[mu];
-        temp *= bottom_vertex(mu, lam_targ, lam_rec);
-
-        result += temp;
-    }
+    result  = regge_factor();
+    (_analytic == true) ? (result *= analytic_amplitude(lam_gam, lam_targ, lam_vec, lam_rec))
+                        : (result *= contract(top_vertex(lam_gam, lam_vec), bottom_vertex(lam_targ, lam_rec)));
 
     return result;
 };
 
 // ---------------------------------------------------------------------------
-// Bottom vertex coupling the target and recoil proton spinors to the vector pomeron
-std::complex<double> jpacPhoto::pomeron_exchange::bottom_vertex(int mu, int lam_targ, int lam_rec)
+// All helicity amplitudes at a single point
+void jpacPhoto::pomeron_exchange::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
 {
-    std::complex<double> result = 0.;
-    for (int i = 0; i < 4; i++)
+    _s = s; _t = t; _theta = _kinematics->theta_s(s, t);
+
+    fill_helicity_amplitudes(regge_factor(), result);
+};
+
+// and on a grid of t at fixed s
+void jpacPhoto::pomeron_exchange::helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result)
+{
+    std::vector<std::complex<double>> alpha;
+    _traj->eval(t, alpha);
+
+    result.resize(t.size());
+    for (int i = 0; i < t.size(); i++)
     {
-        for (int j = 0; j < 4; j++)
-        {
-            std::complex<double> temp;
-            // Recoil oriented an angle theta + pi
-            temp = _kinematics->_recoil->adjoint_component(i, lam_rec, _s, _theta + PI);
+        _s = s; _t = t[i]; _theta = _kinematics->theta_s(s, t[i]);
 
-            // vector coupling
-            temp *= GAMMA[mu][i][j];
+        fill_helicity_amplitudes(regge_factor(alpha[i]), result[i]);
+    }
+};
+
+// Only the vertices depend on helicities, each is calculated once and then contracted
+JPAC_SIMD_CLONES
+void jpacPhoto::pomeron_exchange::fill_helicity_amplitudes(std::complex<double> regge, std::vector<std::complex<double>> & result)
+{
+    result.assign(_kinematics->_nAmps, 0.);
 
-            // target oriented in negative z direction
-            temp *= _kinematics->_target->component(j, lam_targ, _s, PI);
+    // Helicity conserving delta function model
+    if (_model == 1)
+    {
+        for (int i = 0; i < _kinematics->_nAmps; i++)
+        {
+            std::array<int, 4> hel = _kinematics->_helicities[i];
+            if (hel[0] == hel[2] && hel[1] == hel[3]) result[i] = regge;
+        }
+        return;
+    }
 
-            result += temp;
+    if (_analytic == true)
+    {
+        for (int i = 0; i < _kinematics->_nAmps; i++)
+        {
+            std::array<int, 4> hel = _kinematics->_helicities[i];
+            result[i] = regge * analytic_amplitude(hel[0], hel[1], hel[2], hel[3]);
         }
+        return;
     }
 
-    return result;
+    // Currents [lam_gam][lam_vec + 1] and [lam_targ][lam_rec]
+    lorentz_vector top[2][3], bottom[2][2];
+    for (int lam_gam = -1; lam_gam <= 1; lam_gam += 2)
+    {
+        for (int lam_vec = -1; lam_vec <= 1; lam_vec++) top[(lam_gam + 1) / 2][lam_vec + 1] = top_vertex(lam_gam, lam_vec);
+    }
+    for (int lam_targ = -1; lam_targ <= 1; lam_targ += 2)
+    {
+        for (int lam_rec = -1; lam_rec <= 1; lam_rec += 2) bottom[(lam_targ + 1) / 2][(lam_rec + 1) / 2] = bottom_vertex(lam_targ, lam_rec);
+    }
+
+    for (int i = 0; i < _kinematics->_nAmps; i++)
+    {
+        std::array<int, 4> hel = _kinematics->_helicities[i];
+        result[i] = regge * contract(top[(hel[0] + 1) / 2][hel[2] + 1], bottom[(hel[1] + 1) / 2][(hel[3] + 1) / 2]);
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Bottom vertex coupling the target and recoil proton spinors to the vector pomeron
+JPAC_SIMD_CLONES
+jpacPhoto::lorentz_vector jpacPhoto::pomeron_exchange::bottom_vertex(int lam_targ, int lam_rec)
+{
+    // vector coupling ubar(recoil) gamma^mu u(target) 
+    // with recoil oriented an angle theta + pi and target in negative z direction
+    _kinematics->_bilinears->update(_s, _theta);
+    return _kinematics->_bilinears->vector_current(lam_targ, lam_rec);
 };
 
 // ---------------------------------------------------------------------------
 // Top vertex coupling the photon, pomeron, and vector meson.
-std::complex<double> jpacPhoto::pomeron_exchange::top_vertex(int mu, int lam_gam, int lam_vec)
+JPAC_SIMD_CLONES
+jpacPhoto::lorentz_vector jpacPhoto::pomeron_exchange::top_vertex(int lam_gam, int lam_vec)
 {
-    std::complex<double> result = 0.;
+    lorentz_vector result;
+
+    lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+    lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+    lorentz_vector eps_vec = _kinematics->_eps_vec->conjugate_vector(lam_vec, _s, _theta);
 
     if (_model == 0)
     {
-        std::complex<double> sum1 = 0., sum2 = 0.;
-        for (int nu = 0; nu < 4; nu++)
-        {
-            std::complex<double> temp1, temp2;
-
-            // (q . eps_vec^*) eps_gam^mu
-            temp1  = _kinematics->_initial_state->q(nu, _s, 0.);
-            temp1 *= METRIC[nu];
-            temp1 *= _kinematics->_eps_vec->conjugate_component(nu, lam_vec, _s, _theta);
-            sum1  += _kinematics->_eps_gamma->component(mu, lam_gam, _s, 0.) * temp1;
-
-            // (eps_vec^* . eps_gam) q^mu
-            temp2  = _kinematics->_eps_gamma->component(nu, lam_gam, _s, 0.);
-            temp2 *= METRIC[nu];
-            temp2 *= _kinematics->_eps_vec->conjugate_component(nu, lam_vec, _s, _theta);
-            sum2  += _kinematics->_initial_state->q(mu, _s, 0.) * temp2;
-        }
-
-        result = -sum1 + sum2;
+        // - (q . eps_vec^*) eps_gam^mu + (eps_vec^* . eps_gam) q^mu
+        result = q_gam * contract(eps_vec, eps_gam) - eps_gam * contract(q_gam, eps_vec);
     }
     else if (_model == 2)
     {
-        std::complex<double> sum1 = 0., sum2 = 0.;
-        for (int nu = 0; nu < 4; nu++)
-        {
-            std::complex<double> temp1, temp2;
-
-            // -2 * (q . eps_vec^*) eps_gam^mu
-            temp1  = _kinematics->_initial_state->q(nu, _s, 0.);
-            temp1 *= METRIC[nu];
-            temp1 *= _kinematics->_eps_vec->conjugate_component(nu, lam_vec, _s, _theta);
-            sum1  += -2. * _kinematics->_eps_gamma->component(mu, lam_gam, _s, 0.) * temp1;
-
-            // (eps_vec . eps_gam) (q + q')^mu
-            temp2  = _kinematics->_eps_vec->conjugate_component(nu, lam_vec, _s, _theta);
-            temp2 *= METRIC[nu];
-            temp2 *= _kinematics->_eps_gamma->component(nu, lam_gam, _s, 0.);
-            sum2  += (_kinematics->_initial_state->q(mu, _s, 0.) + _kinematics->_final_state->q(mu, _s, _theta)) * temp2;
-        }
-      
-        result = (sum1 + sum2);
+        // -2 * (q . eps_vec^*) eps_gam^mu + (eps_vec . eps_gam) (q + q')^mu
+        lorentz_vector q_vec = _kinematics->_final_state->q(_s, _theta);
+        result = (q_gam + q_vec) * contract(eps_vec, eps_gam) - eps_gam * (2. * contract(q_gam, eps_vec));
     };
 
     return result;
 };
 
+// ---------------------------------------------------------------------------
+// Closed-form helicity amplitudes
+//
+// Both models only need the scalar products of eps_gam, eps_vec^*, q_gam, q_vec
+// and the nucleon current J = ubar gamma u:
+//
+// model 0: (eps_vec^* . eps_gam) (q_gam . J)           -     (eps_gam . J) (q_gam . eps_vec^*)
+// model 2: (eps_vec^* . eps_gam) ((q_gam + q_vec) . J) - 2 * (eps_gam . J) (q_gam . eps_vec^*)
+//
+// With the photon along +z and the vector meson at theta in the x-z plane these are
+//
+// eps_vec^* . eps_gam = - (1 + lam_gam lam_vec cos) / 2              lam_vec = +-1
+//                     = lam_gam E_vec sin / (sqrt(2) m_vec)          lam_vec = 0
+// q_gam . eps_vec^*   = - lam_vec k_gam sin / sqrt(2)                lam_vec = +-1
+//                     = (E_gam k_vec - k_gam E_vec cos) / m_vec      lam_vec = 0
+// eps_gam . J         = (lam_gam J^x + i J^y) / sqrt(2)
+//
+// and the contractions of J with q_gam and q_vec which only depend on the nucleon helicities.
+// The components of J are taken in closed form as in spinor_bilinear::calculate_analytic().
+std::complex<double> jpacPhoto::pomeron_exchange::analytic_amplitude(int lam_gam, int lam_targ, int lam_vec, int lam_rec)
+{
+    update_analytic();
+
+    int a = (lam_targ + 1) / 2, b = (lam_rec + 1) / 2;
+    double lg = double(lam_gam), lv = double(lam_vec);
+
+    // Vector meson pieces
+    std::complex<double> eps_eps, q_eps;
+    if (lam_vec == 0)
+    {
+        eps_eps = lg * _E_vec * _sin / (sqrt(2.) * _m_vec);
+        q_eps   = (_kinematics->_initial_state->energy_V(_s) * _k_vec - _k_gam * _E_vec * _cos) / _m_vec;
+    }
+    else
+    {
+        eps_eps = - (1. + lg * lv * _cos) / 2.;
+        q_eps   = - lv * _k_gam * _sin / sqrt(2.);
+    }
+
+    std::complex<double> eps_J = lg * _XJ[a][b] - _YJ[a][b];
+
+    switch (_model)
+    {
+        case 0: return eps_eps * _qJ[a][b] - eps_J * q_eps;
+        case 2: return eps_eps * (_qJ[a][b] + _vJ[a][b]) - 2. * eps_J * q_eps;
+        default: return 0.;
+    }
+};
+
+// Nucleon current and kinematic factors shared by all helicities
+void jpacPhoto::pomeron_exchange::update_analytic()
+{
+    if (_s == _saved_analytic_s && _theta == _saved_theta && _kinematics->_mX2 == _saved_analytic_mX2 && _kinematics->_mB2 == _saved_mB2) return;
+
+    double s = _s;
+    _cos = cos(_theta); _sin = sin(_theta);
+
+    std::complex<double> E_gam = _kinematics->_initial_state->energy_V(s);
+    _k_gam = _kinematics->_initial_state->momentum(s);
+    _E_vec = _kinematics->_final_state->energy_V(s);
+    _k_vec = _kinematics->_final_state->momentum(s);
+    _m_vec = _kinematics->_final_state->get_mV();
+
+    // omega_pm of the target and recoil spinors
+    std::complex<double> wp  = _kinematics->_target->omega(+1, s), wm  = _kinematics->_target->omega(-1, s);
+    std::complex<double> wpp = _kinematics->_recoil->omega(+1, s), wmp = _kinematics->_recoil->omega(-1, s);
+
+    // Angular factors of the current [lam_targ][lam_rec], see spinor_bilinear.cpp
+    double c = cos(_theta / 2.), sn = sin(_theta / 2.);
+    double S[2][2] = { {c,   -sn}, {sn,  c} };
+    double X[2][2] = { {sn,   c},  {c,  -sn} };
+    double Y[2][2] = { {sn,   c},  {-c,  sn} };
+    double Z[2][2] = { {c,  -sn},  {-sn, -c} };
+
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+            double lam = double(2 * a - 1), lamp = double(2 * b - 1);
+
+            std::complex<double> even = wpp * wp + lam * lamp * wmp * wm;
+            std::complex<double> odd  = lam * wpp * wm + lamp * wmp * wp;
+
+            _qJ[a][b] = E_gam  * even * S[a][b] - _k_gam * odd * Z[a][b];
+            _vJ[a][b] = _E_vec * even * S[a][b] - _k_vec * odd * (_sin * X[a][b] + _cos * Z[a][b]);
+            _XJ[a][b] = odd * X[a][b] / sqrt(2.);
+            _YJ[a][b] = odd * Y[a][b] / sqrt(2.);
+        }
+    }
+
+    _saved_analytic_s = _s; _saved_theta = _theta; _saved_analytic_mX2 = _kinematics->_mX2; _saved_mB2 = _kinematics->_mB2;
+};
+
 // ---------------------------------------------------------------------------
 // Usual Regge power law behavior, s^alpha(t) with an exponential fall from the forward direction
 std::complex<double> jpacPhoto::pomeron_exchange::regge_factor()
+{
+    return regge_factor(_traj->eval(_t));
+};
+
+// with the trajectory at _t already evaluated
+std::complex<double> jpacPhoto::pomeron_exchange::regge_factor(std::complex<double> alpha_t)
 {
     if (_s < _kinematics->sth())
     {
@@ -133,25 +251,88 @@ std::complex<double> jpacPhoto::pomeron_exchange::regge_factor()
         exit(0);
     }
 
+    // Pieces depending only on t or only on s are saved
+    // so only the power s^alpha(t) is calculated at every point
+    const regge_t_factors & x = t_factors(alpha_t);
+    update_s_factors();
+
     std::complex<double> result = 0.;
     
     switch (_model)
     {
         case 0:
+        case 1:
         {
-            double t_min = _kinematics->t_man(_s, 0.); // t_min = t(theta = 0)
-            result  = exp(_b0 * (_t - t_min));
-            result *= pow(_s - _kinematics->sth(), _traj->eval(_t));
-            result *= XI * _norm * E;
-            result /= _s;
+            result = x.residue * _s_factor * exp(x.alpha * _log_s);
+            break;
+        }
+        case 2:
+        {
+            // G_p = -i (eta' s)^(alpha - 1)
+            result = - XI * x.residue * exp((x.alpha - 1.) * _log_s);
             break;
         }
+        default: return 0.;
+    }
+
+    return result;
+};
+
+// ---------------------------------------------------------------------------
+// Energy dependent pieces which do not depend on t
+void jpacPhoto::pomeron_exchange::update_s_factors()
+{
+    if (_s == _saved_s && _kinematics->_mX2 == _saved_mX2 && _kinematics->_mB2 == _saved_s_mB2 && _traj->version() == _saved_traj_version) return;
+
+    switch (_model)
+    {
+        // exp(- b0 t_min) and log(s - s_th)
+        case 0:
         case 1:
         {
             double t_min = _kinematics->t_man(_s, 0.); // t_min = t(theta = 0)
-            result  = exp(_b0 * (_t - t_min));
-            result *= pow(_s - _kinematics->sth(), _traj->eval(_t));
-            result *= XI * _norm * E;
+            _s_factor = exp(- _b0 * t_min);
+            if (_model == 0) _s_factor /= _s;
+
+            _log_s = log(_s - _kinematics->sth());
+            break;
+        }
+        // log(eta' s)
+        case 2:
+        {
+            double etaprime = real(_traj->slope());
+            _log_s = log(etaprime * _s);
+            break;
+        }
+        default: break;
+    }
+
+    _saved_s = _s; _saved_mX2 = _kinematics->_mX2; _saved_s_mB2 = _kinematics->_mB2;
+    _saved_traj_version = _traj->version();
+};
+
+// ---------------------------------------------------------------------------
+// Look up the energy independent factors at the current t or calculate them if needed
+const jpacPhoto::pomeron_exchange::regge_t_factors & jpacPhoto::pomeron_exchange::t_factors(std::complex<double> alpha_t)
+{
+    // The trajectory and masses may have been changed externally since the entry was saved
+    regge_t_factors * saved = _tFactors.find(_t);
+    if (saved != NULL && saved->alpha == alpha_t && saved->mX2 == _kinematics->_mX2)
+    {
+        return *saved;
+    }
+
+    regge_t_factors x;
+    x.mX2   = _kinematics->_mX2;
+    x.alpha = alpha_t;
+
+    switch (_model)
+    {
+        // exponential fall off in t, the t_min part depends on s
+        case 0:
+        case 1:
+        {
+            x.residue = XI * _norm * E * exp(_b0 * _t);
             break;
         }
         case 2:
@@ -162,23 +343,19 @@ std::complex<double> jpacPhoto::pomeron_exchange::regge_factor()
             double beta_0 = 2.;           // Pomeron - light quark coupling
             double beta_c = _norm;        // Pomeron - charm quark coupling
             double mu2 = _b0 * _b0;       // cutoff parameter 
-            double etaprime = real(_traj->slope());
 
             std::complex<double> F_t;
             F_t  = 3. * beta_0;
             F_t *= (th - 2.8* _t);
             F_t /= (th - _t) *  pow((1. - (_t / 0.7)) , 2.);
 
-            std::complex<double> G_p = -XI;
-            G_p  *= pow(XR * etaprime * _s, _traj->eval(_t) - 1.);
-
-            result  = - XI * 8. * beta_c * mu2 * G_p * F_t;
-            result *= 2. * E * F_JPSI / M_JPSI; // Explicitly only for the jpsi... 
-            result /= (mX2 - _t) * (2.*mu2 + mX2 - _t);
+            x.residue  = - XI * 8. * beta_c * mu2 * F_t;
+            x.residue *= 2. * E * F_JPSI / M_JPSI; // Explicitly only for the jpsi... 
+            x.residue /= (mX2 - _t) * (2.*mu2 + mX2 - _t);
             break;
         }
-        default: return 0.;
+        default: x.residue = 0.;
     }
 
-    return result;
+    return _tFactors.insert(_t, x);
 };
@@ -0,0 +1,89 @@
+// Primakoff production off several nuclear targets at once
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+// References:
+// [1] arXiv:2008.01001 [hep-ph]
+// ---------------------------------------------------------------------------
+
+#include "amplitudes/primakoff_batch.hpp"
+
+// ---------------------------------------------------------------------------
+// Set up the kinematics and amplitude of every target
+jpacPhoto::primakoff_batch::primakoff_batch(double mX, std::vector<std::string> targets, double Q2, double coupling)
+{
+    for (int i = 0; i < targets.size(); i++)
+    {
+        nuclear_target target = nuclear_target::get(targets[i]);
+
+        // Elastic scattering off the nucleus
+        reaction_kinematics * kinematics = new reaction_kinematics(mX, target._mass, target._mass);
+        kinematics->set_Q2(Q2);
+        kinematics->set_JP(1, 1);
+
+        _targets.push_back(target);
+        _kinematics.push_back(kinematics);
+        _amps.push_back(new primakoff_effect(kinematics, target._label));
+
+        set_params(i, coupling);
+    }
+};
+
+jpacPhoto::primakoff_batch::~primakoff_batch()
+{
+    for (int i = 0; i < _amps.size(); i++)
+    {
+        delete _amps[i];
+        delete _kinematics[i];
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Each target only touches its own kinematics and amplitude so they can run in parallel
+std::vector<std::vector<double>> jpacPhoto::primakoff_batch::evaluate(std::function<double(int, double)> F, const std::vector<double> & x)
+{
+    std::vector<std::vector<double>> result(_amps.size(), std::vector<double>(x.size()));
+
+    auto fill = [&](int i)
+    {
+        for (int j = 0; j < x.size(); j++) result[i][j] = F(i, x[j]);
+    };
+
+    if (_parallel == false || _amps.size() < 2)
+    {
+        for (int i = 0; i < _amps.size(); i++) fill(i);
+        return result;
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < _amps.size(); i++) threads.push_back(std::thread(fill, i));
+    for (int i = 0; i < threads.size(); i++) threads[i].join();
+
+    return result;
+};
+
+// ---------------------------------------------------------------------------
+std::vector<std::vector<double>> jpacPhoto::primakoff_batch::integrated_xsection(const std::vector<double> & W, bool per_nucleon)
+{
+    auto F = [&](int i, double w)
+    {
+        if (per_nucleon == true) w *= double(_targets[i]._A);
+        return _amps[i]->integrated_xsection(w * w);
+    };
+
+    return evaluate(F, W);
+};
+
+std::vector<std::vector<double>> jpacPhoto::primakoff_batch::differential_xsection(double W, const std::vector<double> & t, bool per_nucleon)
+{
+    auto F = [&](int i, double tt)
+    {
+        double w = W;
+        if (per_nucleon == true) w *= double(_targets[i]._A);
+        return _amps[i]->differential_xsection(w * w, tt);
+    };
+
+    return evaluate(F, t);
+};
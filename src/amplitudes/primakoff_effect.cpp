@@ -19,7 +19,7 @@ double jpacPhoto::primakoff_effect::differential_xsection(double s, double t)
     _formFactor = form_factor(t);
     
     // output
-    long double result = 1.;
+    double result = 1.;
     result  = ALPHA * _photonCoupling*_photonCoupling;
     result /= 8. * sqrt(_mA2) * _mX2 * _mX2 * _pGam * t*t;
     result /= (2. * sqrt(_mA2) * _nu - _mQ2);
@@ -58,6 +58,21 @@ double jpacPhoto::primakoff_effect::integrated_xsection(double s)
 // Normalization
 void jpacPhoto::primakoff_effect::calculate_norm()
 {
+    if (_numerical == false)
+    {
+        _rho0 = 1. / fermi_moment(2);
+
+        // F(q) = sum_k (-1)^k q^2k <r^2k+2> / (2k+1)! <r^2>
+        double factorial = 1.;
+        for (int k = 0; k < _nMoments; k++)
+        {
+            if (k > 0) factorial *= double(2*k) * double(2*k + 1);
+            _ffMoments[k] = pow(-1., double(k)) * _rho0 * fermi_moment(2*k + 2) / factorial;
+        }
+
+        return;
+    }
+
     auto F = [&](double r)
     {
         return r * r * charge_distribution(r);
@@ -74,12 +89,111 @@ void jpacPhoto::primakoff_effect::calculate_norm()
 };
 
 // ---------------------------------------------------------------------------
-// Fourier transform the charge_distribution
+// Form factor at energy x
 double jpacPhoto::primakoff_effect::form_factor(double x)
 {
     // momentum in the t channel
     double q = sqrt(x * (x - 4. * _mA2)) / (2. * sqrt(_mA2));
 
+    if (_numerical == false) return analytic_form_factor(q);
+
+    // from the saved table if possible
+    if (_ffTabulated == true && q <= _ffMaxQ) return _ffTable.Eval(q);
+
+    return numerical_form_factor(q);
+};
+
+// ---------------------------------------------------------------------------
+// Closed form of the fourier transform of the Fermi distribution, with c = radius and a = skin thickness
+// int dr r sin(qr) / (1 + exp((r-c)/a)) = pi a c / sinh(pi q a) * [pi a / c coth(pi q a) sin(q c) - cos(q c)]
+//                                        + 2 a^3 q sum_n (-1)^(n-1) n exp(-n c / a) / (n^2 + q^2 a^2)^2
+double jpacPhoto::primakoff_effect::analytic_form_factor(double q)
+{
+    double a = _skinThickness, c = _atomicRadius;
+
+    // For small q the terms in brackets cancel so use the expansion in moments instead
+    if (q * (c + PI * a) < 0.1)
+    {
+        double result = 0.;
+        for (int k = _nMoments - 1; k >= 0; k--) result = _ffMoments[k] + q*q * result;
+        return result;
+    }
+
+    // 1 / sinh and coth in terms of exp(-2y) so they dont overflow at large q
+    double y = PI * q * a;
+    double e2y = exp(-2. * y);
+    double csch = 2. * exp(-y) / (1. - e2y);
+    double coth = (1. + e2y) / (1. - e2y);
+
+    double result = PI * a * c * csch * (PI * a / c * coth * sin(q * c) - cos(q * c)) / q;
+
+    double sum = 0.;
+    for (int n = 1; n < 100; n++)
+    {
+        double term = pow(-1., double(n - 1)) * n * exp(- n * c / a) / pow(n*n + q*q*a*a, 2.);
+        sum += term;
+        if (std::abs(term) < 1.E-17 * std::abs(sum)) break;
+    }
+    result += 2. * a*a*a * sum;
+
+    return _rho0 * result;
+};
+
+// ---------------------------------------------------------------------------
+// Moments int dr r^n / (1 + exp((r-c)/a)) = n! a^(n+1) F_n(c/a)
+double jpacPhoto::primakoff_effect::fermi_moment(int n)
+{
+    return factorial(n) * pow(_skinThickness, double(n + 1)) * fermi_dirac(n, _atomicRadius / _skinThickness);
+};
+
+// Complete Fermi-Dirac integral F_j(x) = 1/j! int dt t^j / (1 + exp(t - x)) = -Li_(j+1)(-exp(x))
+double jpacPhoto::primakoff_effect::fermi_dirac(int j, double x)
+{
+    int s = j + 1;
+
+    // -Li_s(-exp(x)) = sum_n (-1)^(n-1) exp(n x) / n^s converges for x < 0
+    double result = 0.;
+    double sign = 1.;
+    if (x > 0.)
+    {
+        // Otherwise use the inversion formula
+        // -Li_s(-exp(x)) = 2 sum_k eta(2k) x^(s-2k) / (s-2k)! - (-1)^s * [-Li_s(-exp(-x))]
+        // with the dirichlet eta function eta(2k) = (1 - 2^(1-2k)) zeta(2k)
+        static const double zeta[7] = {-0.5, PI*PI/6., pow(PI, 4.)/90., pow(PI, 6.)/945., pow(PI, 8.)/9450., pow(PI, 10.)/93555., 691.*pow(PI, 12.)/638512875.};
+        if (s / 2 > 6)
+        {
+            std::cout << "Error! fermi_dirac() only implemented for j < 14. Returning 0!\n";
+            return 0.;
+        }
+
+        for (int k = 0; k <= s / 2; k++)
+        {
+            double eta = (1. - pow(2., 1. - 2.*k)) * zeta[k];
+            result += 2. * eta * pow(x, double(s - 2*k)) / factorial(s - 2*k);
+        }
+
+        sign = - pow(-1., double(s));
+        x *= -1.;
+    }
+
+    double sum = 0.;
+    for (int n = 1; n < 10000; n++)
+    {
+        double term = pow(-1., double(n - 1)) * exp(n * x) / pow(double(n), double(s));
+        sum += term;
+        if (std::abs(term) < 1.E-17 * std::abs(sum)) break;
+    }
+
+    return result + sign * sum;
+};
+
+// ---------------------------------------------------------------------------
+// Fourier transform the charge_distribution numerically
+double jpacPhoto::primakoff_effect::numerical_form_factor(double q)
+{
+    // Normalization fixes F(0) = 1
+    if (q < 1.E-10) return 1.;
+
     auto dF = [&] (double r)
     {
         return r * sin(q * r) * charge_distribution(r);
@@ -90,16 +204,90 @@ double jpacPhoto::primakoff_effect::form_factor(double x)
 
     ROOT::Math::Functor1D wF(dF);
     ig.SetFunction(wF);
+
+    // The integrand oscillates so split off the tail past r = c + 40 a
+    // where the distribution is suppressed by exp(-40)
+    double r_cut = _atomicRadius + 40. * _skinThickness;
     
-    return _rho0 * ig.IntegralUp(0.) / q;
+    return _rho0 * (ig.Integral(0., r_cut) + ig.IntegralUp(r_cut)) / q;
+};
+
+// ---------------------------------------------------------------------------
+// Tabulate the form factor on an evenly spaced grid in q
+// Each refinement halves the spacing, the new points are first used to check the
+// interpolation of the previous grid and then added to it.
+void jpacPhoto::primakoff_effect::build_form_factor_table()
+{
+    // F(q) is even so the spline is fit on [-qmax, qmax], otherwise the end point
+    // condition F''(0) = 0 would spoil the interpolation at small q
+    auto set_table = [&](const std::vector<double> & q, const std::vector<double> & F)
+    {
+        std::vector<double> qq(q.rbegin(), q.rend() - 1), FF(F.rbegin(), F.rend() - 1);
+        for (int i = 0; i < qq.size(); i++) qq[i] *= -1.;
+        qq.insert(qq.end(), q.begin(), q.end());
+        FF.insert(FF.end(), F.begin(), F.end());
+        _ffTable.SetData(qq, FF);
+    };
 
+    _ffTabulated = false;
+    if (_numerical == false || _ffTolerance <= 0.) return;
+
+    // The form factor of the Fermi distribution falls off like exp(- pi q a)
+    // so past this it is far below any sensible tolerance
+    _ffMaxQ = 30. / (PI * _skinThickness);
+
+    std::vector<double> q, F;
+    int n = 17;
+    for (int i = 0; i < n; i++)
+    {
+        q.push_back(_ffMaxQ * double(i) / double(n - 1));
+        F.push_back(numerical_form_factor(q.back()));
+    }
+
+    while (true)
+    {
+        set_table(q, F);
+
+        if (2 * n - 1 > _ffMaxPoints)
+        {
+            std::cout << "Warning! Form factor table in primakoff_effect did not converge with " << n << " points. ";
+            std::cout << "Calculating the form factor directly instead.\n";
+            return;
+        }
+
+        // Compare the midpoints with the interpolation
+        std::vector<double> q_mid(n - 1), F_mid(n - 1);
+        double error = 0.;
+        for (int i = 0; i < n - 1; i++)
+        {
+            q_mid[i] = (q[i] + q[i+1]) / 2.;
+            F_mid[i] = numerical_form_factor(q_mid[i]);
+            error = std::max(error, std::abs(F_mid[i] - _ffTable.Eval(q_mid[i])));
+        }
+
+        // Merge midpoints into the grid
+        std::vector<double> q_new, F_new;
+        for (int i = 0; i < n - 1; i++)
+        {
+            q_new.push_back(q[i]);     F_new.push_back(F[i]);
+            q_new.push_back(q_mid[i]); F_new.push_back(F_mid[i]);
+        }
+        q_new.push_back(q.back()); F_new.push_back(F.back());
+
+        q = q_new; F = F_new; n = q.size();
+
+        if (error < _ffTolerance) break;
+    }
+
+    set_table(q, F);
+    _ffTabulated = true;
 };
 
 // ---------------------------------------------------------------------------
 // Amplitude
-long double jpacPhoto::primakoff_effect::amplitude_squared()
+double jpacPhoto::primakoff_effect::amplitude_squared()
 {
-    long double result;
+    double result;
 
     switch (_helProj)
     {
@@ -112,16 +300,24 @@ long double jpacPhoto::primakoff_effect::amplitude_squared()
         // Transverse photon
         case 1:
         {
-            double coshalf2 = (1. + _cosX) / 2.;
-            double sinhalf2 = (1. - _cosX) / 2.;
+            // At high energies pGam ~ pX and enX nu ~ pX pGam so their differences are written out explicitly
+            double mA = sqrt(_mA2);
+            double dp = (_mQ2 + _mX2 - _t * (_nu + _enX) / (2. * mA)) / (_pGam + _pX);          // pGam - pX
+            double dE = (_mX2 * _pGam*_pGam - _enX*_enX * _mQ2) / (_enX*_nu + _pX*_pGam);     // enX nu - pX pGam
+            double dC = 2. * _sinHalfX2;                                                     // 1 - cos
+
+            double symC = dp * dE + 2.*_pX*_pGam*_pGam*dC;
+            double symS = (_pGam + _pX) * dE - 2.*_pX*_pGam*dp + 2.*_pX*_pGam*_pGam*dC;
 
-            double symC = _pX*_pGam*(_pX + _pGam) + _enX*_nu*(_pGam-_pX) - 2.*_pX*_pGam*_pGam*_cosX;
-            double symS = _pX*_pGam*(_pX - _pGam) + _enX*_nu*(_pGam+_pX) - 2.*_pX*_pGam*_pGam*_cosX;
+            // nu (mX^2 + 2 pX^2) - 2 enX pX pGam cos
+            double A = _nu*_nu*_mX2 + _enX*_enX*_mQ2; 
+            double B = _nu*_pX + _enX*_pGam;          // A / B = enX pGam - nu pX
+            double inner = (_nu*_mX2 * A / B - 2.*_pX*_enX*_enX*_mQ2) / B + 2.*_enX*_pX*_pGam*dC;
 
-            double temp = pow(_pGam*(_nu*(_mX2+2.*_pX*_pX) - 2.*_enX*_pX*_pGam*_cosX), 2.) / (2. * _mX2);
+            double temp = pow(_pGam * inner, 2.) / (2. * _mX2);
 
-            result  = pow(coshalf2 * symC, 2.);
-            result += pow(sinhalf2 * symS, 2.);
+            result  = pow(_cosHalfX2 * symC, 2.);
+            result += pow(_sinHalfX2 * symS, 2.);
             result += temp * _sinX2;
 
             break;
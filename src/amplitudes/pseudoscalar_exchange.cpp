@@ -33,48 +33,107 @@ std::complex<double> jpacPhoto::pseudoscalar_exchange::helicity_amplitude(std::a
     }
     else
     {
-        if (lam_vec != lam_gam || lam_targ != lam_rec) 
+        result  = top_residue(lam_gam, lam_vec);
+        result *= bottom_residue(lam_targ, lam_rec);
+        result *= scalar_propagator();
+    }
+
+    // Multiply by the optional expontial form factor
+    result *= form_factor();
+
+    return result;
+};
+
+//------------------------------------------------------------------------------
+// All helicity amplitudes at a single point
+void jpacPhoto::pseudoscalar_exchange::helicity_amplitudes(double s, double t, std::vector<std::complex<double>> & result)
+{
+    _s = s; _t = t, _theta = _kinematics->theta_s(s, t);
+
+    fill_helicity_amplitudes(scalar_propagator() * form_factor(), result);
+};
+
+// and on a grid of t at fixed s
+void jpacPhoto::pseudoscalar_exchange::helicity_amplitudes(double s, const std::vector<double> & t, std::vector<std::vector<std::complex<double>>> & result)
+{
+    // Trajectory and slope for all t together
+    std::vector<std::complex<double>> alpha, alpha_prime;
+    if (_reggeized == true)
+    {
+        _alpha->eval(t, alpha);
+        _alpha->slope(t, alpha_prime);
+    }
+
+    result.resize(t.size());
+    for (int i = 0; i < t.size(); i++)
+    {
+        _s = s; _t = t[i], _theta = _kinematics->theta_s(s, t[i]);
+
+        std::complex<double> scalar;
+        (_reggeized == true) ? (scalar = regge_propagator(alpha[i], alpha_prime[i])) : (scalar = scalar_propagator());
+        
+        fill_helicity_amplitudes(scalar * form_factor(), result[i]);
+    }
+};
+
+// Only the vertices depend on helicities
+JPAC_SIMD_CLONES
+void jpacPhoto::pseudoscalar_exchange::fill_helicity_amplitudes(std::complex<double> scalar, std::vector<std::complex<double>> & result)
+{
+    result.assign(_kinematics->_nAmps, 0.);
+
+    // Covariant vertices for each pair of helicities [lam_gam][lam_vec + 1] and [lam_targ][lam_rec]
+    std::complex<double> top[2][3], bottom[2][2];
+    if (_useFourVecs == true)
+    {
+        for (int lam_gam = -1; lam_gam <= 1; lam_gam += 2)
         {
-            return 0.; 
+            for (int lam_vec = -1; lam_vec <= 1; lam_vec++) top[(lam_gam + 1) / 2][lam_vec + 1] = top_vertex(lam_gam, lam_vec);
         }
-        else
+        for (int lam_targ = -1; lam_targ <= 1; lam_targ += 2)
         {
-            result  = sqrt(2.) * _gNN;
-            result *= _gGamma / _kinematics->_mX;
-            result *= sqrt(XR * _t) / 2.;
-            result *= (_kinematics->_mX2 - _t);
-            result *= scalar_propagator();
+            for (int lam_rec = -1; lam_rec <= 1; lam_rec += 2) bottom[(lam_targ + 1) / 2][(lam_rec + 1) / 2] = bottom_vertex(lam_targ, lam_rec);
         }
     }
 
-    // Multiply by the optional expontial form factor
-    if (_useFF == true)
+    for (int i = 0; i < _kinematics->_nAmps; i++)
     {
-        double tprime = _t - _kinematics->t_man(s, 0.);
-        result *= exp(_b * tprime);
+        int lam_gam  = _kinematics->_helicities[i][0];
+        int lam_targ = _kinematics->_helicities[i][1];
+        int lam_vec  = _kinematics->_helicities[i][2];
+        int lam_rec  = _kinematics->_helicities[i][3];
+
+        if (_useFourVecs == true)
+        {
+            result[i] = top[(lam_gam + 1) / 2][lam_vec + 1] * bottom[(lam_targ + 1) / 2][(lam_rec + 1) / 2] * scalar;
+        }
+        else
+        {
+            // Residues vanish unless both vertices are helicity non-flip
+            if (lam_vec != lam_gam || lam_targ != lam_rec) continue;
+            result[i] = top_residue(lam_gam, lam_vec) * bottom_residue(lam_targ, lam_rec) * scalar;
+        }
     }
+};
 
-    return result;
+//------------------------------------------------------------------------------
+// Optional exponential form factor
+double jpacPhoto::pseudoscalar_exchange::form_factor()
+{
+    if (_useFF == false) return 1.;
+
+    double tprime = _t - _kinematics->t_man(_s, 0.);
+    return exp(_b * tprime);
 };
 
 //------------------------------------------------------------------------------
 // Nucleon vertex
+JPAC_SIMD_CLONES
 std::complex<double> jpacPhoto::pseudoscalar_exchange::bottom_vertex(double lam_targ, double lam_rec)
 {
-    std::complex<double> result = 0.;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            // ubar(recoil) * gamma_5 * u(target)
-            std::complex<double> temp;
-            temp  = _kinematics->_recoil->adjoint_component(i, lam_rec, _s, _theta + PI); // theta_recoil = theta + pi
-            temp *= GAMMA_5[i][j];
-            temp *= _kinematics->_target->component(j, lam_targ, _s, PI); // theta_target = pi
-
-            result += temp;
-        }
-    }
+    // ubar(recoil) * gamma_5 * u(target)
+    _kinematics->_bilinears->update(_s, _theta);
+    std::complex<double> result = _kinematics->_bilinears->pseudoscalar_current(lam_targ, lam_rec);
 
     // Sqrt(2) from isospin considering a charged pion field
     // remove the Sqrt(2) if considering a neutral pion exchange
@@ -85,6 +144,7 @@ std::complex<double> jpacPhoto::pseudoscalar_exchange::bottom_vertex(double lam_
 
 //------------------------------------------------------------------------------
 // Photon vertex
+JPAC_SIMD_CLONES
 std::complex<double> jpacPhoto::pseudoscalar_exchange::top_vertex(double lam_gam, double lam_vec)
 {
     std::complex<double> result = 0.;
@@ -92,66 +152,60 @@ std::complex<double> jpacPhoto::pseudoscalar_exchange::top_vertex(double lam_gam
     // A - V - P
     if (_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == 1)
     {
-         std::complex<double> term1 = 0., term2 = 0.;
-        for (int mu = 0; mu < 4; mu++)
-        {
-            for (int nu = 0; nu < 4; nu++)
-            {
-                // (eps*_lam . eps_gam)(q_vec . q_gam)
-                std::complex<double> temp1;
-                temp1  = _kinematics->_eps_vec->conjugate_component(mu, lam_vec, _s, _theta);
-                temp1 *= METRIC[mu];
-                temp1 *= _kinematics->_eps_gamma->component(mu, lam_gam, _s, 0.);
-                temp1 *= _kinematics->_initial_state->q(nu, _s, 0.);
-                temp1 *= METRIC[nu];
-                temp1 *= _kinematics->_final_state->q(nu, _s, _theta);
-
-                term1 += temp1;
-
-                // (eps*_lam . q_gam)(eps_gam . q_vec)
-                std::complex<double> temp2;
-                temp2  = _kinematics->_eps_vec->conjugate_component(mu, lam_vec, _s, _theta);
-                temp2 *= METRIC[mu];
-                temp2 *= _kinematics->_initial_state->q(mu, _s, 0.);
-                temp2 *= _kinematics->_eps_gamma->component(nu, lam_gam, _s, 0.);
-                temp2 *= METRIC[nu];
-                temp2 *= _kinematics->_final_state->q(nu, _s, _theta);
-
-                term2 += temp2;
-
-                result = (temp1 - temp2) / _kinematics->_mX;
-            }
-        }
+        lorentz_vector eps_vec = _kinematics->_eps_vec->conjugate_vector(lam_vec, _s, _theta);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector q_vec   = _kinematics->_final_state->q(_s, _theta);
+
+        // (eps*_lam . eps_gam)(q_vec . q_gam) - (eps*_lam . q_gam)(eps_gam . q_vec)
+        result  = contract(eps_vec, eps_gam) * contract(q_vec, q_gam);
+        result -= contract(eps_vec, q_gam) * contract(eps_gam, q_vec);
+        result /= _kinematics->_mX;
     }
 
     // V - V - P
     if (_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == -1)
     {
-        // Contract with LeviCivita
-        for (int mu = 0; mu < 4; mu ++)
-        {
-            for (int alpha = 0; alpha < 4; alpha++)
-            {
-                for (int beta = 0; beta < 4; beta++)
-                {
-                    for (int gamma = 0; gamma < 4; gamma++)
-                    {
-                        std::complex<double> temp;
-                        temp = levi_civita(mu, alpha, beta, gamma);
-                        if (std::abs(temp) < 0.001) continue;
-                        temp *= _kinematics->_eps_vec->conjugate_component(mu, lam_vec, _s, _theta);
-                        temp *= _kinematics->_eps_gamma->field_tensor(alpha, beta, lam_gam, _s, 0.);
-                        temp *= _kinematics->_final_state->q(gamma, _s, _theta) - _kinematics->t_exchange_momentum(gamma, _s, _theta);
-                        result += temp;
-                    }
-                }
-            }
-        }
+        lorentz_vector eps_vec = _kinematics->_eps_vec->conjugate_vector(lam_vec, _s, _theta);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector k       = _kinematics->_final_state->q(_s, _theta) - _kinematics->t_exchange_momentum(_s, _theta);
+
+        // Contract with LeviCivita, the field tensor F^{alpha beta} = q^alpha eps^beta - q^beta eps^alpha gives a factor of 2
+        // epsilon indices are summed against the components directly so lower one to undo the metric in contract()
+        result = 2. * contract(eps_vec, levi_civita(q_gam, eps_gam, k).lower());
     }
 
     return _gGamma * result;
 };
 
+//------------------------------------------------------------------------------
+// Analytic residues
+// The vertices above evaluated in the rest frame of the exchange (t-channel)
+// Only available for axial-vector production
+
+// Photon - Axial - Pseudoscalar: (q_vec . q_gam) / mX with only transverse axial-vectors
+std::complex<double> jpacPhoto::pseudoscalar_exchange::top_residue(int lam_gam, int lam_vec)
+{
+    if (lam_vec != lam_gam) return 0.;
+
+    std::complex<double> result = (_kinematics->_mX2 - _t) / (2. * _kinematics->_mX);
+    return _gGamma * result;
+};
+
+// Baryon - Baryon - Pseudoscalar
+std::complex<double> jpacPhoto::pseudoscalar_exchange::bottom_residue(int lam_targ, int lam_rec)
+{
+    if (lam_targ != lam_rec) return 0.;
+
+    // ubar gamma_5 v = sqrt(t - (mT - mR)^2)
+    double mT = _kinematics->_mT, mR = _kinematics->_mR;
+    std::complex<double> result = sqrt(XR * (_t - (mT - mR) * (mT - mR)));
+
+    // Sqrt(2) from isospin as in bottom_vertex()
+    return sqrt(2.) * _gNN * result;
+};
+
 //------------------------------------------------------------------------------
 // Simple pole propagator
 std::complex<double> jpacPhoto::pseudoscalar_exchange::scalar_propagator()
@@ -162,16 +216,16 @@ std::complex<double> jpacPhoto::pseudoscalar_exchange::scalar_propagator()
     }
     else
     {
-        std::complex<double> alpha_t = _alpha->eval(_t);
-
-        if (std::abs(alpha_t) > 20.) return 0.;
-
-        // Else use the regge propagator
-        std::complex<double> result = 1.;
-        result  = - _alpha->slope();
-        result *= 0.5 * (double(_alpha->_signature) +  exp(-XI * PI * alpha_t));
-        result *= cgamma(0. - alpha_t);
-        result *= pow(_s, alpha_t);
-        return result;
+        return regge_propagator(_alpha->eval(_t), _alpha->slope(_t));
     }
 };
+
+// Regge propagator
+// signature factor, Gamma(-alpha) and s^alpha are evaluated together in log space
+std::complex<double> jpacPhoto::pseudoscalar_exchange::regge_propagator(std::complex<double> alpha_t, std::complex<double> slope_t)
+{
+    std::complex<double> result = 1.;
+    result  = - slope_t;
+    result *= regge_factor(_alpha->_signature, alpha_t, 0, _s);
+    return result;
+};
@@ -8,123 +8,65 @@
 #include "amplitudes/rarita_exchange.hpp"
 
 //------------------------------------------------------------------------------
-// Combine everything and contract indices
-std::complex<double> jpacPhoto::rarita_exchange::helicity_amplitude(std::array<int, 4> helicities, double s, double t)
+// Relative momentum either entering (top vertex) or exiting (bottom vertex) the propagator
+jpacPhoto::lorentz_vector jpacPhoto::rarita_exchange::relative_momentum(momentum_leg leg)
 {
-    int lam_gam = helicities[0];
-    int lam_targ = helicities[1];
-    int lam_vec = helicities[2];
-    int lam_rec = helicities[3];
-
-    // Store the invariant energies to avoid having to pass them around 
-    _s = s; _t = t, _theta = _kinematics->theta_s(s, t);
-
-    std::complex<double> result = 0.;
-    for (int i = 0; i < 4; i++)
+    switch (leg)
     {
-        for (int j = 0; j < 4; j++)
+        case kInitial: return _kinematics->_initial_state->q(_s, 0.) - _kinematics->_initial_state->p(_s, PI);
+        case kFinal:   return _kinematics->_final_state->q(_s, _theta) - _kinematics->_final_state->p(_s, _theta + PI);
+        default:
         {
-            std::complex<double> temp;
-            temp  = top_vertex(i, lam_gam, lam_rec);
-            temp *= rarita_propagator(i, j);
-            temp *= bottom_vertex(j, lam_vec, lam_targ);
-
-            result += temp;
+            std::cout << "Error! Unknown momentum leg passed to relative_momentum. Returning zero vector...\n";
+            return lorentz_vector();
         }
     }
-
-    return result;
 };
 
 //------------------------------------------------------------------------------
-// rank-2 traceless tensor
-std::complex<double> jpacPhoto::rarita_exchange::g_bar(int mu, int nu)
+// Rarita-Schwinger Propagator
+// (p-slash + m) [ - k . g_bar . k' + 1/3 (k . g_bar . gamma) (gamma . g_bar . k') ] / (p^2 - m^2)
+// with g_bar^{mu nu} = p^mu p^nu / m^2 - g^{mu nu} and k, k' the relative momenta at either vertex.
+// All products are 4x4 matrix products in spinor space.
+void jpacPhoto::rarita_exchange::calculate_propagator()
 {
-    std::complex<double> result;
-    result = _kinematics->u_exchange_momentum(mu, _s, _theta) * _kinematics->u_exchange_momentum(nu, _s, _theta) / _mEx2;
-
-    if (mu == nu)
-    {
-        result -= METRIC[mu];
-    }
+    lorentz_vector p     = _kinematics->u_exchange_momentum(_s, _theta);
+    lorentz_vector k_in  = relative_momentum(kInitial);
+    lorentz_vector k_out = relative_momentum(kFinal);
 
-    return result;
-};
+    lorentz_tensor g_bar = outer(p, p) / _mEx2 - metric();
 
-// g_bar contracted with gamma^nu
-std::complex<double> jpacPhoto::rarita_exchange::slashed_g_bar(int mu, int i, int j)
-{
-    std::complex<double> result = 0.;
+    // k . g_bar . k' and the two slashed vectors (k . g_bar . gamma), (gamma . g_bar . k')
+    std::complex<double> kgk = contract(k_in, g_bar, k_out);
+    std::complex<double> slashed_in[4][4], slashed_out[4][4], slashed_p[4][4];
+    slash(contract(k_in, g_bar), slashed_in);
+    slash(contract(g_bar, k_out), slashed_out);
+    slash(p, slashed_p);
 
-    for (int nu = 0; nu < 4; nu++)
+    // Bracket in spin space
+    std::complex<double> bracket[4][4];
+    for (int i = 0; i < 4; i++)
     {
-        std::complex<double> temp;
-        temp  = g_bar(mu, nu);
-        temp *= METRIC[nu];
-        temp *= GAMMA[nu][i][j];
-
-        result += temp;
-    }
-
-    return result;
-};
-
-//------------------------------------------------------------------------------
-// Relative momentum either entering (top vertex) or exiting (bottom vertex) the propagator
-std::complex<double> jpacPhoto::rarita_exchange::relative_momentum(int mu, std::string in_out)
-{
-    std::complex<double> q1_mu, q2_mu;
+        for (int j = 0; j < 4; j++)
+        {
+            std::complex<double> product = 0.;
+            for (int k = 0; k < 4; k++) product += slashed_in[i][k] * slashed_out[k][j];
 
-    if ((in_out == "in") || (in_out == "top") || (in_out == "initial") )
-    {
-        q1_mu = _kinematics->_initial_state->q(mu, _s, 0.);
-        q2_mu = _kinematics->_initial_state->p(mu, _s, PI);
-    }
-    else if ((in_out == "out") || (in_out == "bot") || (in_out == "final"))
-    {
-        q1_mu = _kinematics->_final_state->q(mu, _s, _theta);
-        q2_mu = _kinematics->_final_state->p(mu, _s, _theta + PI);
-    }
-    else
-    {
-        std::cout << "Error! Unkown parameter: " << in_out << "passed to relative_momentum. ";
-        std::cout << "Quitting...";
-        exit(1);
+            bracket[i][j] = product / 3.;
+            if (i == j) bracket[i][j] -= kgk;
+        }
     }
 
-    return q1_mu - q2_mu;
-}
-
-//------------------------------------------------------------------------------
-// Rarita-Schwinger Propagator
-std::complex<double> jpacPhoto::rarita_exchange::rarita_propagator(int i, int j)
-{
-    std::complex<double> result = 0.;
-
-    for (int mu = 0; mu < 4; mu++)
+    // Multiply by the spin-1/2 propagator from the left
+    std::complex<double> denominator = real(contract(p, p)) - _mEx2;
+    for (int i = 0; i < 4; i++)
     {
-        for(int nu = 0; nu < 4; nu++)
+        for (int j = 0; j < 4; j++)
         {
-            std::complex<double> term_1;
-            term_1  = relative_momentum(mu, "in");
-            term_1 *= METRIC[mu];
-            term_1 *= g_bar(mu, nu);
-            term_1 *= METRIC[nu];
-            term_1 *= relative_momentum(nu, "out");
-
-            std::complex<double> term_2;
-            term_2  = relative_momentum(mu, "in");
-            term_2 *= METRIC[mu];
-            term_2 *= slashed_g_bar(mu, i, j);
-            term_2 *= slashed_g_bar(nu, i, j);
-            term_2 *= METRIC[nu];
-            term_2 *= relative_momentum(nu, "out");
+            std::complex<double> product = _mEx * bracket[i][j];
+            for (int k = 0; k < 4; k++) product += slashed_p[i][k] * bracket[k][j];
 
-            result += -term_1 + term_2 / 3.;
+            _propagator[i][j] = product / denominator;
         }
-        }
-
-    result *= dirac_propagator(i, j);
-
-    return result;
-}
+    }
+};
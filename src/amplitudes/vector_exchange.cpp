@@ -24,10 +24,11 @@ std::complex<double> jpacPhoto::vector_exchange::helicity_amplitude(std::array<i
     // Output
     std::complex<double> result;
 
-    // if psuedo scalar or scalar production do covariant
-    if (!(_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == 1) || _useCovariant == true)
+    // Feynman rules, with the Regge propagator in place of the pole if reggeized
+    if (_useCovariant == true)
     {
         result = covariant_amplitude(helicities);
+        if (_ifReggeized == true) result *= covariant_regge_factor();
     }
     else
     {
@@ -47,7 +48,7 @@ std::complex<double> jpacPhoto::vector_exchange::helicity_amplitude(std::array<i
         // Pole with d function residue if fixed spin
         if (_ifReggeized == false)
         {
-            result *= wigner_d_int_cos(1, lam, lamp, _zt);
+            result *= d_function(2, 2 * lam, 2 * lamp, _zt);
             result /= t - _mEx2;
         }
         // or regge propagator if reggeized
@@ -92,6 +93,9 @@ double jpacPhoto::vector_exchange::form_factor()
 
 // ---------------------------------------------------------------------------
 // Analytic residues for Regge form
+// These are the vertices contracted with the exchange polarization in its rest frame (t-channel)
+// with the same couplings as in top_vertex() and bottom_vertex() below.
+// Only available for axial-vector production, where the phases agree with the Feynman rules.
 
 // Photon - Axial - Vector
 std::complex<double> jpacPhoto::vector_exchange::top_residue(int lam_gam, int lam_vec)
@@ -122,25 +126,30 @@ std::complex<double> jpacPhoto::vector_exchange::top_residue(int lam_gam, int la
     return  XI * double(lam_gam) * result * q * _gGam;
 };
 
-// Nucleon - Nucleon - Vector
+// Baryon - Baryon - Vector
 std::complex<double> jpacPhoto::vector_exchange::bottom_residue(int lam_targ, int lam_rec)
 {
     // TODO: Explicit phases in terms of lam_targ and lam_rec instead of difference
     int lamp = (lam_targ - lam_rec) / 2.;
 
+    double mT = _kinematics->_mT, mR = _kinematics->_mR;
+
+    // sqrt(t - (mT - mR)^2) / sqrt(t), equal to one for elastic vertices
+    std::complex<double> delta = sqrt(XR * (_t - (mT - mR) * (mT - mR))) / sqrt(XR * _t);
+
     std::complex<double> vector, tensor;
     switch (std::abs(lamp))
     {
         case 0:
         {
-            vector =  1.;
-            tensor = sqrt(XR * _t) / (2. * M_PROTON);
+            vector = (mT + mR);
+            tensor = _t / (2. * M_PROTON);
             break;
         }
         case 1:
         {
-            vector = sqrt(2.) * sqrt(XR * _t) / (2. * M_PROTON);
-            tensor = sqrt(2.);
+            vector = sqrt(2.) * sqrt(XR * _t);
+            tensor = sqrt(2.) * sqrt(XR * _t) * (mT + mR) / (2. * M_PROTON);
             break;
         }
         case 2:
@@ -154,11 +163,7 @@ std::complex<double> jpacPhoto::vector_exchange::bottom_residue(int lam_targ, in
         }
     }
 
-    std::complex<double> result;
-    result = _gV * vector + _gT * tensor * sqrt(XR * _t) / (2. * M_PROTON);
-    result *= 2. * M_PROTON;
-
-    return result;
+    return delta * (_gV * vector + _gT * tensor);
 };
 
 // ---------------------------------------------------------------------------
@@ -172,27 +177,58 @@ std::complex<double> jpacPhoto::vector_exchange::regge_propagator(int j, int lam
         return 0.;
     }
 
+    // Everything but s^(alpha - M) and the half angles only depends on t
+    const regge_t_factors & x = t_factors();
+
+    std::complex<double> result;
+    result  = wigner_leading_coeff(j, lam, lamp);
+    for (int i = 0; i < j - M; i++) result /= x.barrier;
+    result *= half_angle_factor(lam, lamp);
+
+    // Signature factor, Gamma(1 - alpha) and s^(alpha - M) together
+    // (finite for all t so no cutoff in alpha is needed)
+    result *= - x.slope;
+    result *= x.signature * exp(x.log_gamma + (x.alpha - double(M)) * log(_s));
+
+    return result;
+};
+
+// Regge propagator multiplying the Feynman rules residues, which already grow like s
+// Reduces to 1 / (t - mEx2) at the pole alpha(mEx2) = 1
+std::complex<double> jpacPhoto::vector_exchange::covariant_regge_factor()
+{
+    const regge_t_factors & x = t_factors();
+
+    std::complex<double> result;
+    result  = x.slope;
+    result *= x.signature * exp(x.log_gamma + (x.alpha - 1.) * log(_s));
+
+    return result;
+};
+
+// ---------------------------------------------------------------------------
+// Look up the energy independent factors at the current t or calculate them if needed
+const jpacPhoto::vector_exchange::regge_t_factors & jpacPhoto::vector_exchange::t_factors()
+{
+    // The trajectory and masses may have been changed externally since the entry was saved
     std::complex<double> alpha_t = _alpha->eval(_t);
 
-    // the gamma function causes problesm for large t so
-    if (std::abs(alpha_t) > 30.)
+    regge_t_factors * saved = _tFactors.find(_t);
+    if (saved != NULL && saved->alpha == alpha_t && saved->mX2 == _kinematics->_mX2 && saved->version == _alpha->version())
     {
-        return 0.;
+        return *saved;
     }
-    else
-    {
-        std::complex<double> result;
-        result  = wigner_leading_coeff(j, lam, lamp);
-        result /= barrier_factor(j, M);
-        result *= half_angle_factor(lam, lamp);
 
-        result *= - _alpha->slope();
-        result *= 0.5 * (double(_alpha->_signature) + exp(-XI * PI * alpha_t));
-        result *= cgamma(1. - alpha_t);
-        result *= pow(_s, alpha_t - double(M));
+    regge_t_factors x;
+    x.mX2       = _kinematics->_mX2;
+    x.version   = _alpha->version();
+    x.alpha     = alpha_t;
+    x.slope     = _alpha->slope(_t);
+    x.signature = 0.5 * (double(_alpha->_signature) + exp(- XI * PI * alpha_t));
+    x.log_gamma = lanczos_gamma(1. - alpha_t, 1);
+    x.barrier   = barrier_factor(1, 0);
 
-        return result;
-    }
+    return _tFactors.insert(_t, x);
 };
 
 //------------------------------------------------------------------------------
@@ -202,9 +238,10 @@ std::complex<double> jpacPhoto::vector_exchange::half_angle_factor(int lam, int
     std::complex<double> sinhalf = sqrt((XR - _zt) / 2.);
     std::complex<double> coshalf = sqrt((XR + _zt) / 2.);
 
-    std::complex<double> result;
-    result  = pow(sinhalf, double(std::abs(lam - lamp)));
-    result *= pow(coshalf, double(std::abs(lam + lamp)));
+    // Integer powers by repeated multiplication instead of complex pow
+    std::complex<double> result = 1.;
+    for (int i = 0; i < std::abs(lam - lamp); i++) result *= sinhalf;
+    for (int i = 0; i < std::abs(lam + lamp); i++) result *= coshalf;
 
     return result;
 };
@@ -213,8 +250,10 @@ std::complex<double> jpacPhoto::vector_exchange::half_angle_factor(int lam, int
 // Angular momentum barrier factor
 std::complex<double> jpacPhoto::vector_exchange::barrier_factor(int j, int M)
 {
+    double mT = _kinematics->_mT, mR = _kinematics->_mR;
+
     std::complex<double> q = (_t - _kinematics->_mX2) / sqrt(4. * _t * XR);
-    std::complex<double> p = sqrt(XR * _t - 4.* M2_PROTON) / 2.;
+    std::complex<double> p = sqrt(XR * (_t - (mT + mR) * (mT + mR))) * sqrt(XR * (_t - (mT - mR) * (mT - mR))) / sqrt(4. * XR * _t);
 
     std::complex<double> result = pow(2. * p * q, double(j - M));
 
@@ -232,117 +271,96 @@ std::complex<double> jpacPhoto::vector_exchange::covariant_amplitude(std::array<
     int lam_vec = helicities[2];
     int lam_rec = helicities[3];
 
-    std::complex<double> result = 0.;
+    update_currents();
+
+    // Only the last contraction of the Lorentz indices depends on the helicities
+    return contract(_top_current[lam_gam + 1][lam_vec + 1], _propagated_current[(lam_targ + 1) / 2][(lam_rec + 1) / 2]);
+};
+
+// ---------------------------------------------------------------------------
+// Calculate both vertices for all helicities at once at the current kinematic point
+JPAC_SIMD_CLONES
+void jpacPhoto::vector_exchange::update_currents()
+{
+    if (_s == _saved_s && _t == _saved_t && _kinematics->_mX2 == _saved_mX2 && _kinematics->_mB2 == _saved_mB2) return;
 
-    // Need to contract the Lorentz indices
-    for (int mu = 0; mu < 4; mu++)
+    // Photon - Meson - Vector for each photon and meson helicity
+    int j = _kinematics->_jp[0];
+    for (int lam_gam = -1; lam_gam <= 1; lam_gam += 2)
     {
-        for(int nu = 0; nu < 4; nu++)
+        for (int lam_vec = -j; lam_vec <= j; lam_vec++)
         {
-            std::complex<double> temp;
-            temp  = top_vertex(mu, lam_gam, lam_vec);
-            temp *= METRIC[mu];
-            temp *= vector_propagator(mu, nu);
-            temp *= METRIC[nu];
-            temp *= bottom_vertex(nu, lam_targ, lam_rec);
-
-            result += temp;
+            _top_current[lam_gam + 1][lam_vec + 1] = top_vertex(lam_gam, lam_vec);
         }
     }
 
-    return result;
+    // Nucleon - Nucleon - Vector contracted with the propagator, which is the same for all helicities
+    lorentz_tensor propagator = vector_propagator();
+    for (int lam_targ = -1; lam_targ <= 1; lam_targ += 2)
+    {
+        for (int lam_rec = -1; lam_rec <= 1; lam_rec += 2)
+        {
+            _propagated_current[(lam_targ + 1) / 2][(lam_rec + 1) / 2] = contract(propagator, bottom_vertex(lam_targ, lam_rec));
+        }
+    }
+
+    _saved_s = _s; _saved_t = _t; _saved_mX2 = _kinematics->_mX2; _saved_mB2 = _kinematics->_mB2;
 };
 
 // ---------------------------------------------------------------------------
 // Photon - Axial Vector - Vector vertex
-std::complex<double> jpacPhoto::vector_exchange::top_vertex(int mu, int lam_gam, int lam_vec)
+JPAC_SIMD_CLONES
+jpacPhoto::lorentz_vector jpacPhoto::vector_exchange::top_vertex(int lam_gam, int lam_vec)
 {
-    std::complex<double> result = 0.;
+    lorentz_vector result;
 
     // A-V-V coupling
     if (_kinematics->_jp[0]== 1 && _kinematics->_jp[1] == 1)
     {
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector eps_vec = _kinematics->_eps_vec->vector(lam_vec, _s, _theta);
+
         // Contract with LeviCivita
-        for (int alpha = 0; alpha < 4; alpha++)
-        {
-            for (int beta = 0; beta < 4; beta++)
-            {
-                for (int gamma = 0; gamma < 4; gamma++)
-                {
-                    std::complex<double> temp;
-                    temp = levi_civita(mu, alpha, beta, gamma);
-                    if (std::abs(temp) < 0.001) continue;
-                
-                    temp *= METRIC[mu];
-                    temp *= _kinematics->_initial_state->q(alpha, _s, 0.);
-                    temp *= _kinematics->_eps_gamma->component(beta, lam_gam, _s, 0.);
-                    temp *= _kinematics->_eps_vec->component(gamma, lam_vec, _s, _theta);
-
-                    result += temp;
-                }
-            }
-        }
+        result = levi_civita(q_gam, eps_gam, eps_vec).lower();
     }
 
     // V-V-V coupling
     else if (_kinematics->_jp[0] == 1 && _kinematics->_jp[1] == -1)
     {
-        for (int nu = 0; nu < 4; nu++)
-        {
-            std::complex<double> temp = XI;
-            temp *= METRIC[mu];
-            temp *= _kinematics->_eps_gamma->field_tensor(mu, nu, lam_gam, _s, _theta);
-            temp *= METRIC[nu];
-            temp *= _kinematics->_eps_vec->component(nu, lam_vec, _s, _theta);
-            result += temp;
-        }
+        // i F^{mu nu} eps_nu with F^{mu nu} = q^mu eps_gam^nu - q^nu eps_gam^mu
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector eps_vec = _kinematics->_eps_vec->vector(lam_vec, _s, _theta);
+
+        result  = q_gam * contract(eps_gam, eps_vec) - eps_gam * contract(q_gam, eps_vec);
+        result  = result * XI;
     }
 
     // S-V-V coupling
     else if (_kinematics->_jp[0]== 0 && _kinematics->_jp[1] == 1)
     {
-        for (int nu = 0; nu < 4; nu++)
-        {
-            std::complex<double> term1, term2;
-
-            // (k . q) eps_gamma^mu
-            term1  = _kinematics->t_exchange_momentum(nu, _s, _theta);
-            term1 *= METRIC[nu];
-            term1 *= _kinematics->_initial_state->q(nu, _s, 0.);
-            term1 *= _kinematics->_eps_gamma->component(mu, lam_gam, _s, 0.);
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector k       = _kinematics->t_exchange_momentum(_s, _theta);
 
-            // (eps_gam . k) q^mu
-            term2  = _kinematics->_eps_gamma->component(nu, lam_gam, _s, 0.);
-            term2 *= METRIC[nu];
-            term2 *= _kinematics->t_exchange_momentum(nu, _s, _theta);
-            term2 *= _kinematics->_initial_state->q(mu, _s, 0.);
-
-            result += term1 - term2;
-        }
+        // (k . q) eps_gamma^mu - (eps_gam . k) q^mu
+        result  = eps_gam * contract(k, q_gam) - q_gam * contract(eps_gam, k);
 
         // Dimensionless coupling requires dividing by the mX
-        result /= _kinematics->_mX;
+        result = result / _kinematics->_mX;
     }
 
     // P-V-V coupling
     if (_kinematics->_jp[0]== 0 && _kinematics->_jp[1] == -1)
     {
-        // Contract with LeviCivita
-        for (int alpha = 0; alpha < 4; alpha++)
-        {
-            for (int beta = 0; beta < 4; beta++)
-            {
-                for (int gamma = 0; gamma < 4; gamma++)
-                {
-                    std::complex<double> temp;
-                    temp = levi_civita(mu, alpha, beta, gamma);
-                    if (std::abs(temp) < 0.001) continue;
-                    temp *= _kinematics->_eps_gamma->field_tensor(alpha, beta, lam_gam, _s, 0.);
-                    temp *= _kinematics->_final_state->q(gamma, _s, _theta) - _kinematics->t_exchange_momentum(gamma, _s, _theta);
-                    result += temp;
-                }
-            }
-        }
+        lorentz_vector q_gam   = _kinematics->_initial_state->q(_s, 0.);
+        lorentz_vector eps_gam = _kinematics->_eps_gamma->vector(lam_gam, _s, 0.);
+        lorentz_vector q_vec   = _kinematics->_final_state->q(_s, _theta) - _kinematics->t_exchange_momentum(_s, _theta);
+
+        // Contract with LeviCivita, the antisymmetric (q^alpha eps^beta - q^beta eps^alpha) gives a factor of 2
+        // epsilon indices are summed against the components directly so lower to undo the metric in contract()
+        result = 2. * levi_civita(q_gam, eps_gam, q_vec).lower();
     }
 
     // Multiply by coupling
@@ -351,64 +369,36 @@ std::complex<double> jpacPhoto::vector_exchange::top_vertex(int mu, int lam_gam,
 
 // ---------------------------------------------------------------------------
 // Nucleon - Nucleon - Vector vertex
-std::complex<double> jpacPhoto::vector_exchange::bottom_vertex(int mu, int lam_targ, int lam_rec)
+JPAC_SIMD_CLONES
+jpacPhoto::lorentz_vector jpacPhoto::vector_exchange::bottom_vertex(int lam_targ, int lam_rec)
 {
-    // Vector coupling piece
-    std::complex<double> vector = 0.;
-    for (int i = 0; i < 4; i++)
-    {
-        for (int j = 0; j < 4; j++)
-        {
-            std::complex<double> temp;
-            temp  = _kinematics->_recoil->adjoint_component(i, lam_rec, _s, _theta + PI); // theta_rec = theta + pi
-            temp *= GAMMA[mu][i][j];
-            temp *= _kinematics->_target->component(j, lam_targ, _s, PI); // theta_targ = pi
+    _kinematics->_bilinears->update(_s, _theta);
 
-            vector += temp;
-        }
-    }
+    // Vector coupling piece
+    lorentz_vector vector;
+    vector = _kinematics->_bilinears->vector_current(lam_targ, lam_rec);
 
     // Tensor coupling piece
-    std::complex<double> tensor = 0.;
+    lorentz_vector tensor;
     if (abs(_gT) > 0.001)
     {
-        for (int i = 0; i < 4; i++)
-        {
-            for (int j = 0; j < 4; j++)
-            {
-                std::complex<double> sigma_q_ij = 0.;
-                for (int nu = 0; nu < 4; nu++)
-                {
-                sigma_q_ij += sigma(mu, nu, i, j) * METRIC[nu] * _kinematics->t_exchange_momentum(nu, _s, _theta) / (2. * M_PROTON);
-                }
-
-                std::complex<double> temp;
-                temp = _kinematics->_recoil->adjoint_component(i, lam_rec, _s, _theta + PI); // theta_rec = theta + pi
-                temp *= sigma_q_ij;
-                temp *= _kinematics->_target->component(j, lam_targ, _s, PI); // theta_targ = pi
-
-                tensor += temp;
-            }
-        }
+        // sigma^{mu nu} contracted with the exchanged momentum
+        tensor = _kinematics->_bilinears->tensor_current(lam_targ, lam_rec) / (2. * M_PROTON);
     }
 
-    return _gV * vector - _gT * tensor;
+    return vector * _gV - tensor * _gT;
 };
 
 // ---------------------------------------------------------------------------
 // Propagator of a massive spin-one particle
-std::complex<double> jpacPhoto::vector_exchange::vector_propagator(int mu, int nu)
+JPAC_SIMD_CLONES
+jpacPhoto::lorentz_tensor jpacPhoto::vector_exchange::vector_propagator()
 {
     // q_mu q_nu / mEx2 - g_mu nu
-    std::complex<double> result;
-    result = _kinematics->t_exchange_momentum(mu, _s, _theta) * _kinematics->t_exchange_momentum(nu, _s, _theta) / _mEx2;
-
-    if (mu == nu)
-    {
-        result -= METRIC[mu];
-    }
+    lorentz_vector q = _kinematics->t_exchange_momentum(_s, _theta);
 
-    result /= _t - _mEx2;
+    // No fixed mass if reggeized, the pole is in covariant_regge_factor()
+    if (_ifReggeized == true) return outer(q, q) / _t - metric();
 
-    return result;
-};
\ No newline at end of file
+    return (outer(q, q) / _mEx2 - metric()) / (_t - _mEx2);
+};
@@ -42,6 +42,7 @@ std::complex<double> jpacPhoto::dirac_spinor::component(int i, int lambda, doubl
     }
 
     // theta convention
+#ifndef JPAC_CHIRAL_BASIS
     switch (i)
     {
         case 0: return                  omega(+1, s) * half_angle( lambda, theta);
@@ -54,12 +55,35 @@ std::complex<double> jpacPhoto::dirac_spinor::component(int i, int lambda, doubl
             return 0.;
         }
     }
+#else
+    // Left- and right-handed components (upper -+ lower of the Dirac basis spinor)
+    std::complex<double> omega_L = (omega(+1, s) - double(lambda) * omega(-1, s)) / sqrt(2.);
+    std::complex<double> omega_R = (omega(+1, s) + double(lambda) * omega(-1, s)) / sqrt(2.);
+
+    switch (i)
+    {
+        case 0: return                  omega_L * half_angle( lambda, theta);
+        case 1: return double(lambda) * omega_L * half_angle(-lambda, theta);
+        case 2: return                  omega_R * half_angle( lambda, theta);
+        case 3: return double(lambda) * omega_R * half_angle(-lambda, theta);
+        default : 
+        {
+            std::cout << "dirac_spinor: Invalid component index " << i << " passed as argument!\n";
+            return 0.;
+        }
+    }
+#endif
 };
 
 std::complex<double> jpacPhoto::dirac_spinor::adjoint_component(int i, int lambda, double s, double theta)
 {
+#ifndef JPAC_CHIRAL_BASIS
     double phase;
     (i == 2 || i == 3) ? (phase = -1.) : (phase = 1.);
 
     return phase * component(i, lambda, s, theta);
+#else
+    // gamma_0 swaps left- and right-handed components
+    return component((i + 2) % 4, lambda, s, theta);
+#endif
 };
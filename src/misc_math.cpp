@@ -0,0 +1,68 @@
+// Tabulated factorials and binomial coefficients
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "misc_math.hpp"
+
+#include <limits>
+
+// ---------------------------------------------------------------------------
+// Both tables are filled with the recursions n! = n (n-1)! and
+// (n choose k) = (n choose k-1) (n - k + 1) / k the first time they are needed.
+// Initialization of a local static is thread-safe so this happens exactly once.
+
+namespace
+{
+    struct coefficient_tables
+    {
+        double _factorial[jpacPhoto::FACTORIAL_MAX + 1];
+        double _binomial[jpacPhoto::BINOMIAL_MAX + 1][jpacPhoto::BINOMIAL_MAX + 1];
+
+        coefficient_tables()
+        {
+            _factorial[0] = 1.;
+            for (int n = 1; n <= jpacPhoto::FACTORIAL_MAX; n++)
+            {
+                _factorial[n] = double(n) * _factorial[n - 1];
+            }
+
+            for (int n = 0; n <= jpacPhoto::BINOMIAL_MAX; n++)
+            {
+                _binomial[n][0] = 1.;
+                for (int k = 1; k <= jpacPhoto::BINOMIAL_MAX; k++)
+                {
+                    _binomial[n][k] = (k > n) ? 0. : _binomial[n][k - 1] * double(n - k + 1) / double(k);
+                }
+            }
+        };
+    };
+
+    const coefficient_tables & tables()
+    {
+        static const coefficient_tables TABLES;
+        return TABLES;
+    };
+};
+
+// ---------------------------------------------------------------------------
+double jpacPhoto::factorial(int n)
+{
+    if (n < 0) return 0.;
+    if (n > FACTORIAL_MAX) return std::numeric_limits<double>::infinity();
+
+    return tables()._factorial[n];
+};
+
+// ---------------------------------------------------------------------------
+double jpacPhoto::binomial(int n, int k)
+{
+    if (k < 0 || k > n) return 0.;
+    if (n <= BINOMIAL_MAX) return tables()._binomial[n][k];
+
+    double result = 1.;
+    for (int i = 1; i <= k; i++) result *= double(n - k + i) / double(i);
+    return result;
+};
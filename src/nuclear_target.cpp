@@ -0,0 +1,56 @@
+// Registry of nuclear targets with the parameters of their Fermi model charge distributions
+// used for e.g. Primakoff production
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+// References:
+// [1] arXiv:2008.01001 [hep-ph]
+// ---------------------------------------------------------------------------
+
+#include "nuclear_target.hpp"
+
+// ---------------------------------------------------------------------------
+// Saved targets, starting with the ones used in [1]
+std::map<std::string, jpacPhoto::nuclear_target> & jpacPhoto::nuclear_target::registry()
+{
+    static std::map<std::string, nuclear_target> targets = 
+    {
+        {"U238",  {"U238",  "^{238}U",  92, 238, 221.6977, 34.48, 3.07 }},
+        {"Sn124", {"Sn124", "^{124}Sn", 50, 124, 115.3924, 27.56, 2.73 }},
+        {"Zn70",  {"Zn70",  "^{70}Zn",  30,  70,  65.1202, 22.34, 2.954}}
+    };
+
+    return targets;
+};
+
+// ---------------------------------------------------------------------------
+jpacPhoto::nuclear_target jpacPhoto::nuclear_target::get(std::string name)
+{
+    std::map<std::string, nuclear_target>::iterator entry = registry().find(name);
+    if (entry == registry().end())
+    {
+        std::cout << "Error! nuclear_target " << name << " not found. Add it with nuclear_target::add() first!\n";
+        std::cout << "Exiting...\n";
+        exit(0);
+    }
+
+    return entry->second;
+};
+
+void jpacPhoto::nuclear_target::add(nuclear_target target)
+{
+    registry()[target._name] = target;
+};
+
+std::vector<std::string> jpacPhoto::nuclear_target::list()
+{
+    std::vector<std::string> names;
+    for (std::map<std::string, nuclear_target>::iterator entry = registry().begin(); entry != registry().end(); ++entry)
+    {
+        names.push_back(entry->first);
+    }
+
+    return names;
+};
@@ -49,3 +49,11 @@ std::complex<double> jpacPhoto::polarization_vector::conjugate_component(int i,
 {
     return conj(component(i, lambda, s, theta));
 };
+
+// ---------------------------------------------------------------------------
+// Full four-vector
+jpacPhoto::lorentz_vector jpacPhoto::polarization_vector::vector(int lambda, double s, double theta)
+{
+    return lorentz_vector(component(0, lambda, s, theta), component(1, lambda, s, theta),
+                          component(2, lambda, s, theta), component(3, lambda, s, theta));
+};
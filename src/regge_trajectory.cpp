@@ -0,0 +1,152 @@
+// Non-linear regge trajectories which need more than an inline function
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "regge_trajectory.hpp"
+#include "constants.hpp"
+
+#include "Math/GSLIntegrator.h"
+#include "Math/IntegrationTypes.h"
+#include "Math/Functor.h"
+
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+// Dispersive trajectory
+
+// s / pi * int ds' Im alpha(s') / (s' (s' - s))
+std::complex<double> dispersive_trajectory::dispersive_integral(double s)
+{
+    if (std::abs(s) < 1.E-12) return 0.;
+
+    // Im alpha(s') / s'
+    auto g = [&](double x)
+    {
+        return _imag(x) / x;
+    };
+
+    ROOT::Math::GSLIntegrator ig(ROOT::Math::IntegrationOneDim::kADAPTIVE, ROOT::Math::Integration::kGAUSS61);
+
+    // Below threshold the integrand is regular
+    if (s < _sth)
+    {
+        auto F = [&](double x)
+        {
+            return g(x) / (x - s);
+        };
+        ROOT::Math::Functor1D wF(F);
+        ig.SetFunction(wF);
+
+        return s / jpacPhoto::PI * ig.IntegralUp(_sth);
+    }
+
+    // Above threshold take the principal value by subtracting g(s) on an interval
+    // symmetric around the pole, where int dx / (x - s) vanishes,
+    // and add the imaginary part from the pole
+    double gs = g(s);
+    auto F_sub = [&](double x)
+    {
+        return (g(x) - gs) / (x - s);
+    };
+    ROOT::Math::Functor1D wF_sub(F_sub);
+    ig.SetFunction(wF_sub);
+
+    // Split at the pole so it is never evaluated
+    double pv = ig.Integral(_sth, s) + ig.Integral(s, 2. * s - _sth);
+
+    auto F_tail = [&](double x)
+    {
+        return g(x) / (x - s);
+    };
+    ROOT::Math::Functor1D wF_tail(F_tail);
+    ig.SetFunction(wF_tail);
+
+    pv += ig.IntegralUp(2. * s - _sth);
+
+    return s / jpacPhoto::PI * pv + jpacPhoto::XI * _imag(s);
+};
+
+// 1 / pi * int ds' Im alpha(s') / (s' - s)^2, only finite below threshold
+double dispersive_trajectory::dispersive_derivative(double s)
+{
+    auto F = [&](double x)
+    {
+        return _imag(x) / ((x - s) * (x - s));
+    };
+
+    ROOT::Math::GSLIntegrator ig(ROOT::Math::IntegrationOneDim::kADAPTIVE, ROOT::Math::Integration::kGAUSS61);
+    ROOT::Math::Functor1D wF(F);
+    ig.SetFunction(wF);
+
+    return ig.IntegralUp(_sth) / jpacPhoto::PI;
+};
+
+// ---------------------------------------------------------------------------
+// Index of s in the saved grid or -1 if not there
+int dispersive_trajectory::find(double s)
+{
+    std::vector<double>::iterator it = std::lower_bound(_grid.begin(), _grid.end(), s);
+    if (it == _grid.end() || *it != s) return -1;
+    return it - _grid.begin();
+};
+
+std::complex<double> dispersive_trajectory::eval(double s)
+{
+    int i = find(s);
+    if (i >= 0) return _saved_alpha[i];
+
+    return _a0 + _aprime * s + dispersive_integral(s);
+};
+
+std::complex<double> dispersive_trajectory::slope(double s)
+{
+    int i = find(s);
+    if (i >= 0) return _saved_slope[i];
+
+    if (s < _sth) return _aprime + dispersive_derivative(s);
+
+    // Above threshold use a finite difference
+    double h = 1.E-4 * std::max(1., std::abs(s));
+    return (eval(s + h) - eval(s - h)) / (2. * h);
+};
+
+// ---------------------------------------------------------------------------
+// Evaluate and save the trajectory and its slope on a whole grid
+void dispersive_trajectory::eval(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+{
+    // Sorted copy of the grid without duplicates, only recalculated if the grid has changed
+    std::vector<double> grid(s);
+    std::sort(grid.begin(), grid.end());
+    grid.erase(std::unique(grid.begin(), grid.end()), grid.end());
+
+    if (grid != _grid)
+    {
+        std::vector<std::complex<double>> alpha(grid.size()), alpha_prime(grid.size());
+
+        _grid.clear();
+        for (int i = 0; i < grid.size(); i++)
+        {
+            alpha[i]       = eval(grid[i]);
+            alpha_prime[i] = slope(grid[i]);
+        }
+
+        _grid = grid;
+        _saved_alpha = alpha;
+        _saved_slope = alpha_prime;
+    }
+
+    result.resize(s.size());
+    for (int i = 0; i < s.size(); i++) result[i] = _saved_alpha[find(s[i])];
+};
+
+void dispersive_trajectory::slope(const std::vector<double> & s, std::vector<std::complex<double>> & result)
+{
+    std::vector<std::complex<double>> alpha;
+    eval(s, alpha);
+
+    result.resize(s.size());
+    for (int i = 0; i < s.size(); i++) result[i] = _saved_slope[find(s[i])];
+};
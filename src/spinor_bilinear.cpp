@@ -0,0 +1,345 @@
+// Bilinears of the target and recoil nucleon spinors, ubar(recoil) Γ u(target),
+// evaluated for all four helicity combinations at once from cached spinors.
+//
+// Author:       Daniel Winney (2020)
+// Affiliation:  Joint Physics Analysis Center (JPAC)
+// Email:        dwinney@iu.edu
+// ---------------------------------------------------------------------------
+
+#include "spinor_bilinear.hpp"
+
+// ---------------------------------------------------------------------------
+// Check the saved kinematics and recalculate spinors and currents if needed
+void jpacPhoto::spinor_bilinear::update(double s, double theta)
+{
+    double masses[4] = {_target->get_state()->get_mV2(), _target->get_state()->get_mB2(),
+                        _recoil->get_state()->get_mV2(), _recoil->get_state()->get_mB2()};
+
+    bool same = !_empty && (s == _cached_s) && (theta == _cached_theta);
+    for (int n = 0; n < 4 && same; n++)
+    {
+        same = (masses[n] == _cached_masses[n]);
+    }
+    if (same) return;
+
+    // Save kinematics
+    _cached_s = s; _cached_theta = theta;
+    for (int n = 0; n < 4; n++)
+    {
+        _cached_masses[n] = masses[n];
+    }
+    _empty = false;
+    _spinors_empty = true;
+    _tensor_empty = true;
+
+    switch (_mode)
+    {
+        case 0: calculate_numeric(); break;
+        case 1: calculate_analytic(); break;
+        case 2: calculate_analytic(); compare_numeric(); break;
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Spinor components for both helicities
+void jpacPhoto::spinor_bilinear::fill_spinors()
+{
+    if (!_spinors_empty) return;
+
+    for (int k = 0; k < 2; k++)
+    {
+        int lam = 2 * k - 1;
+        for (int i = 0; i < 4; i++)
+        {
+            _u[k][i]    = _target->component(i, lam, _cached_s, PI);                          // theta_targ = pi
+            _ubar[k][i] = _recoil->adjoint_component(i, lam, _cached_s, _cached_theta + PI);  // theta_rec = theta + pi
+        }
+    }
+
+    _spinors_empty = false;
+};
+
+// ---------------------------------------------------------------------------
+// Currents which do not depend on any external vectors from explicit contractions
+JPAC_SIMD_CLONES
+void jpacPhoto::spinor_bilinear::calculate_numeric()
+{
+    fill_spinors();
+
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+#ifndef JPAC_CHIRAL_BASIS
+            std::complex<double> scalar = 0., pseudo = 0.;
+            for (int i = 0; i < 4; i++)
+            {
+                scalar += _ubar[b][i] * _u[a][i];
+                for (int j = 0; j < 4; j++)
+                {
+                    pseudo += _ubar[b][i] * GAMMA_5[i][j] * _u[a][j];
+                }
+            }
+            _scalar[a][b] = scalar;
+            _pseudoscalar[a][b] = pseudo;
+
+            for (int mu = 0; mu < 4; mu++)
+            {
+                std::complex<double> vector = 0.;
+                for (int i = 0; i < 4; i++)
+                {
+                    for (int j = 0; j < 4; j++)
+                    {
+                        vector += _ubar[b][i] * GAMMA[mu][i][j] * _u[a][j];
+                    }
+                }
+                _vector[a][b].set(mu, vector);
+            }
+#else
+            // In the chiral basis gamma_5 is diagonal and gamma^mu only
+            // connects the upper and lower 2-component blocks
+            std::complex<double> upper = _ubar[b][0] * _u[a][0] + _ubar[b][1] * _u[a][1];
+            std::complex<double> lower = _ubar[b][2] * _u[a][2] + _ubar[b][3] * _u[a][3];
+            _scalar[a][b] = upper + lower;
+            _pseudoscalar[a][b] = lower - upper;
+
+            for (int mu = 0; mu < 4; mu++)
+            {
+                std::complex<double> vector = 0.;
+                for (int i = 0; i < 2; i++)
+                {
+                    for (int j = 0; j < 2; j++)
+                    {
+                        vector += _ubar[b][i]     * GAMMA[mu][i][j + 2] * _u[a][j + 2];
+                        vector += _ubar[b][i + 2] * GAMMA[mu][i + 2][j] * _u[a][j];
+                    }
+                }
+                _vector[a][b].set(mu, vector);
+            }
+#endif
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Closed-form currents in the CoM frame.
+// With omega_pm (omega'_pm) for the target (recoil) and c, s the cosine and sine
+// of theta / 2, every current factorizes into an energy factor which depends only on the
+// helicities and an angular factor from the two-component helicity spinors:
+//
+// ubar u           = (w'+ w+ - lam lam' w'- w-) S
+// ubar gamma_5 u   = (lam w'+ w- - lam' w'- w+) S
+// ubar gamma^0 u   = (w'+ w+ + lam lam' w'- w-) S
+// ubar gamma^i u   = (lam w'+ w- + lam' w'- w+) (X, Y, Z)^i
+//
+// where for (lam, lam') = (+,+), (+,-), (-,+), (-,-)
+// S = c, s, -s, c ; X = -s, c, c, s ; Y = i s, -i c, i c, i s ; Z = -c, -s, -s, c
+void jpacPhoto::spinor_bilinear::calculate_analytic()
+{
+    double s = _cached_s, theta = _cached_theta;
+
+    std::complex<double> wp  = _target->omega(+1, s), wm  = _target->omega(-1, s);
+    std::complex<double> wpp = _recoil->omega(+1, s), wmp = _recoil->omega(-1, s);
+
+    double c = cos(theta / 2.), sn = sin(theta / 2.);
+
+    // Angular factors [lam_targ][lam_rec]
+    double S[2][2] = { {c,   -sn}, {sn,  c} };
+    double X[2][2] = { {sn,   c},  {c,  -sn} };
+    double Y[2][2] = { {sn,   c},  {-c,  sn} };  // times i
+    double Z[2][2] = { {c,  -sn},  {-sn, -c} };
+
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+            double lam = double(2 * a - 1), lamp = double(2 * b - 1);
+
+            std::complex<double> even = wpp * wp + lam * lamp * wmp * wm;
+            std::complex<double> odd  = lam * wpp * wm + lamp * wmp * wp;
+
+            _scalar[a][b]       = (wpp * wp - lam * lamp * wmp * wm) * S[a][b];
+            _pseudoscalar[a][b] = (lam * wpp * wm - lamp * wmp * wp) * S[a][b];
+
+            _vector[a][b].set(0, even * S[a][b]);
+            _vector[a][b].set(1, odd  * X[a][b]);
+            _vector[a][b].set(2, odd  * XI * Y[a][b]);
+            _vector[a][b].set(3, odd  * Z[a][b]);
+        }
+    }
+
+    // Momenta entering the Gordon identity for the tensor current
+    _p_sum = _recoil->get_state()->p(s, theta) + _target->get_state()->p(s, 0.);
+    _m_sum = _recoil->get_state()->get_mB() + _target->get_state()->get_mB();
+};
+
+// ---------------------------------------------------------------------------
+// Cross-check the closed-form currents against the numeric contractions
+void jpacPhoto::spinor_bilinear::compare_numeric()
+{
+    lorentz_vector analytic[2][2], analytic_tensor[2][2];
+    std::complex<double> analytic_scalar[2][2], analytic_pseudoscalar[2][2];
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+            analytic[a][b]              = _vector[a][b];
+            analytic_tensor[a][b]       = tensor_current(2 * a - 1, 2 * b - 1);
+            analytic_scalar[a][b]       = _scalar[a][b];
+            analytic_pseudoscalar[a][b] = _pseudoscalar[a][b];
+        }
+    }
+
+    calculate_numeric();
+    lorentz_vector q = _recoil->get_state()->p(_cached_s, _cached_theta) - _target->get_state()->p(_cached_s, 0.);
+
+    double scale = abs(_cached_s), worst = 0.;
+    for (int a = 0; a < 2; a++)
+    {
+        for (int b = 0; b < 2; b++)
+        {
+            lorentz_vector numeric_tensor = tensor_current(q, 2 * a - 1, 2 * b - 1);
+
+            worst = std::max(worst, abs(analytic_scalar[a][b] - _scalar[a][b]));
+            worst = std::max(worst, abs(analytic_pseudoscalar[a][b] - _pseudoscalar[a][b]));
+            for (int mu = 0; mu < 4; mu++)
+            {
+                worst = std::max(worst, abs(analytic[a][b][mu] - _vector[a][b][mu]));
+                worst = std::max(worst, abs(analytic_tensor[a][b][mu] - numeric_tensor[mu]) / sqrt(scale));
+            }
+        }
+    }
+
+    if (worst > 1.E-8 * sqrt(scale))
+    {
+        std::cout << "\nspinor_bilinear: Closed-form and numeric currents differ by " << worst;
+        std::cout << " at s = " << _cached_s << ", theta = " << _cached_theta << "!\n";
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Generic contractions
+std::complex<double> jpacPhoto::spinor_bilinear::contract(const std::complex<double> M[4][4], int lam_targ, int lam_rec)
+{
+    fill_spinors();
+    int a = index(lam_targ), b = index(lam_rec);
+
+    std::complex<double> result = 0.;
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            result += _ubar[b][i] * M[i][j] * _u[a][j];
+        }
+    }
+
+    return result;
+};
+
+void jpacPhoto::spinor_bilinear::row(const std::complex<double> M[4][4], int lam_rec, std::complex<double> out[4])
+{
+    fill_spinors();
+    int b = index(lam_rec);
+    for (int j = 0; j < 4; j++)
+    {
+        out[j] = 0.;
+        for (int i = 0; i < 4; i++)
+        {
+            out[j] += _ubar[b][i] * M[i][j];
+        }
+    }
+};
+
+void jpacPhoto::spinor_bilinear::column(const std::complex<double> M[4][4], int lam_targ, std::complex<double> out[4])
+{
+    fill_spinors();
+    int a = index(lam_targ);
+    for (int i = 0; i < 4; i++)
+    {
+        out[i] = 0.;
+        for (int j = 0; j < 4; j++)
+        {
+            out[i] += M[i][j] * _u[a][j];
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Tensor current, only recalculated if q or the kinematics change
+jpacPhoto::lorentz_vector jpacPhoto::spinor_bilinear::tensor_current(const lorentz_vector & q, int lam_targ, int lam_rec)
+{
+    if (_tensor_empty || !(q == _tensor_q))
+    {
+        calculate_tensor(q);
+    }
+
+    return _tensor[index(lam_targ)][index(lam_rec)];
+};
+
+// Momentum transfer q = p_rec - p_targ, for which the Gordon identity gives
+// ubar sigma^{mu nu} q_nu u = (p_rec + p_targ)^mu ubar u - (m_rec + m_targ) ubar gamma^mu u
+jpacPhoto::lorentz_vector jpacPhoto::spinor_bilinear::tensor_current(int lam_targ, int lam_rec)
+{
+    if (_mode == 0)
+    {
+        lorentz_vector q = _recoil->get_state()->p(_cached_s, _cached_theta) - _target->get_state()->p(_cached_s, 0.);
+        return tensor_current(q, lam_targ, lam_rec);
+    }
+
+    int a = index(lam_targ), b = index(lam_rec);
+    return _p_sum * _scalar[a][b] - _vector[a][b] * _m_sum;
+};
+
+JPAC_SIMD_CLONES
+void jpacPhoto::spinor_bilinear::calculate_tensor(const lorentz_vector & q)
+{
+    // sigma^{mu nu} only needs to be calculated once
+    // initialization of a local static is thread-safe so the table is filled exactly once
+    struct sigma_table { std::complex<double> _entries[4][4][4][4]; };
+    static const sigma_table SIGMA = []() -> sigma_table
+    {
+        sigma_table table;
+        for (int mu = 0; mu < 4; mu++)
+        {
+            for (int nu = 0; nu < 4; nu++)
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    for (int j = 0; j < 4; j++)
+                    {
+                        table._entries[mu][nu][i][j] = sigma(mu, nu, i, j);
+                    }
+                }
+            }
+        }
+        return table;
+    }();
+
+    for (int mu = 0; mu < 4; mu++)
+    {
+        // sigma^{mu nu} q_nu as a 4x4 matrix
+        std::complex<double> sigma_q[4][4];
+        for (int i = 0; i < 4; i++)
+        {
+            for (int j = 0; j < 4; j++)
+            {
+                sigma_q[i][j] = 0.;
+                for (int nu = 0; nu < 4; nu++)
+                {
+                    sigma_q[i][j] += SIGMA._entries[mu][nu][i][j] * METRIC[nu] * q[nu];
+                }
+            }
+        }
+
+        for (int a = 0; a < 2; a++)
+        {
+            for (int b = 0; b < 2; b++)
+            {
+                _tensor[a][b].set(mu, contract(sigma_q, 2 * a - 1, 2 * b - 1));
+            }
+        }
+    }
+
+    _tensor_q = q;
+    _tensor_empty = false;
+};
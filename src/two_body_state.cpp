@@ -44,3 +44,17 @@ std::complex<double> jpacPhoto::two_body_state::p(int mu, double s, double theta
         }
     }
 };
+
+// ---------------------------------------------------------------------------
+// Full four-vectors at once
+jpacPhoto::lorentz_vector jpacPhoto::two_body_state::q(double s, double theta)
+{
+    std::complex<double> k = momentum(s);
+    return lorentz_vector(energy_V(s), k * sin(theta), 0., k * cos(theta));
+};
+
+jpacPhoto::lorentz_vector jpacPhoto::two_body_state::p(double s, double theta)
+{
+    std::complex<double> k = momentum(s);
+    return lorentz_vector(energy_B(s), - k * sin(theta), 0., - k * cos(theta));
+};
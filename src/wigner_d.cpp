@@ -8,22 +8,52 @@
 #include "misc_math.hpp"
 
 // --------------------------------------------------------------------------
+// (2j)! / sqrt((j-M)! (j+M)! (j-N)! (j+N)!) / 2^(j-M)
+static double wigner_leading_magnitude(int j, int M, int N)
+{
+    double result = jpacPhoto::factorial(2*j);
+    result /= sqrt(jpacPhoto::factorial(j-M) * jpacPhoto::factorial(j+M) * jpacPhoto::factorial(j-N) * jpacPhoto::factorial(j+N));
+    result /= pow(2.,  double(j-M));
+
+    return result;
+};
+
 double jpacPhoto::wigner_leading_coeff(int j, int lam1, int lam2)
 {
     int M = std::max(std::abs(lam1), std::abs(lam2));
     int N = std::min(std::abs(lam1), std::abs(lam2));
 
+    if (M > j) return 0.;
+
+    // (-1)^(lam1 - lam2) if lam1 > lam2
     int lambda = std::abs(lam1 - lam2) + lam1 - lam2;
+    double phase = ((lambda / 2) % 2 == 0) ? 1. : -1.;
 
-    double result = (double) factorial(2*j);
-    result /= sqrt( (double) factorial(j-M));
-    result /= sqrt( (double) factorial(j+M));
-    result /= sqrt( (double) factorial(j-N));
-    result /= sqrt( (double) factorial(j+N));
-    result /= pow(2.,  double(j-M));
-    result *= pow(-1., double(lambda)/2.);
+    // Magnitudes for every j <= WIGNER_JMAX, M <= j and N <= M
+    // filled once on first use (initialization of a local static is thread-safe)
+    struct leading_table { double _entries[WIGNER_JMAX + 1][WIGNER_JMAX + 1][WIGNER_JMAX + 1]; };
+    static const leading_table TABLE = []() -> leading_table
+    {
+        leading_table table = {};
+        for (int jj = 0; jj <= WIGNER_JMAX; jj++)
+        {
+            for (int MM = 0; MM <= jj; MM++)
+            {
+                for (int NN = 0; NN <= MM; NN++)
+                {
+                    table._entries[jj][MM][NN] = wigner_leading_magnitude(jj, MM, NN);
+                }
+            }
+        }
+        return table;
+    }();
 
-    return result;
+    if (j <= WIGNER_JMAX)
+    {
+        return phase * TABLE._entries[j][M][N];
+    }
+
+    return phase * wigner_leading_magnitude(j, M, N);
 };
 
 // ---------------------------------------------------------------------------
@@ -32,251 +62,333 @@ double jpacPhoto::wigner_leading_coeff(int j, int lam1, int lam2)
 // lam1 = 2 * lambda and lam2 = 2 * lambda^prime are integers
 double jpacPhoto::wigner_d_half(int j, int lam1, int lam2, double theta)
 {
-    double phase = 1.;
+    return wigner_d(j, lam1, lam2, theta);
+};
 
-    // If first lam argument is smaller, switch them
-    if (abs(lam1) < abs(lam2))
-    {
-        int temp = lam1;
-        lam1 = lam2;
-        lam2 = temp;
+// ---------------------------------------------------------------------------
+double jpacPhoto::wigner_d_int(int j, int lam1, int lam2, double theta)
+{
+    return wigner_d(2 * j, 2 * lam1, 2 * lam2, theta);
+};
 
-        phase *= pow(-1., double(lam1 - lam2) / 2.);
+// ---------------------------------------------------------------------------
+std::complex<double> jpacPhoto::wigner_d_int_cos(int j, int lam1, int lam2, double cosine)
+{
+    // Careful because this loses the +- phase of the sintheta. 
+    return wigner_d_cos(2 * j, 2 * lam1, 2 * lam2, cosine);
+};
+
+// ---------------------------------------------------------------------------
+// GENERAL SPIN
+// ---------------------------------------------------------------------------
+
+namespace jpacPhoto
+{
+    // Everything that depends only on j and the helicities:
+    // d^j_{lam1 lam2} = norm * sin^a(theta/2) * cos^b(theta/2) * P_k^{(a,b)}(cos theta)
+    struct wigner_jacobi_params
+    {
+        int k, a, b;
+        double norm;
     };
 
-    // If first lam is negative, switch them
-    if (lam1 < 0)
+    // All arguments in units of 1/2
+    inline wigner_jacobi_params jacobi_params(int j, int lam1, int lam2)
     {
-        lam1 *= -1;
-        lam2 *= -1;
+        wigner_jacobi_params x;
 
-        phase *= pow(-1., double(lam1 - lam2) / 2.);
-    }
+        int k2 = std::min(std::min(j + lam2, j - lam2), std::min(j + lam1, j - lam1));
+        int lambda;
+        if      (k2 == j + lam2) { x.a = (lam1 - lam2) / 2; lambda = x.a; }
+        else if (k2 == j - lam2) { x.a = (lam2 - lam1) / 2; lambda = 0;   }
+        else if (k2 == j + lam1) { x.a = (lam2 - lam1) / 2; lambda = 0;   }
+        else                     { x.a = (lam1 - lam2) / 2; lambda = x.a; }
 
-    double result = 0.;
+        x.k = k2 / 2;
+        x.b = j - k2 - x.a;
+        x.norm  = sqrt(binomial(j - x.k, x.k + x.a) / binomial(x.k + x.b, x.b));
+        x.norm *= (lambda % 2 == 0) ? 1. : -1.;
 
-    int id = ((lam2 > 0) - (lam2 < 0)) * (j * 100 + lam1 * 10 + abs(lam2)); // negative sign refers to negative lam2
-    switch (id)
+        return x;
+    };
+
+    // Jacobi polynomial P_n^{(a,b)}(x) from upward recurrence in n
+    template<typename T>
+    inline T jacobi(int n, int a, int b, T x)
     {
-        // spin 1/2 
-        case  111: 
-        {
-            result =  cos(theta / 2.); 
-            break;
-        };
-        case -111: 
-        {
-            result = -sin(theta / 2.); 
-            break;
-        };
+        T p0 = 1.;
+        if (n == 0) return p0;
 
-        // spin 3/2
-        case  333:       
+        T p1 = double(a - b) / 2. + double(a + b + 2) * x / 2.;
+        for (int m = 2; m <= n; m++)
         {
-            result = cos(theta / 2.) / 2.;
-            result *= (1. + cos(theta));
-            break;
-        }
-        case  331:
-        {
-            result = - sqrt(3.) / 2.;
-            result *= sin(theta / 2.);
-            result *= 1. + cos(theta);
-            break;
-        }
-        case -331:
-        {
-            result = sqrt(3.) / 2.;
-            result *= cos(theta / 2.);
-            result *= 1. - cos(theta);
-            break;
-        }
-        case -333:
-        {
-            result = - sin(theta / 2.) / 2.;
-            result *= 1. - cos(theta);
-            break;
-        }
-        case  311:
-        {
-            result = 1. / 2.;
-            result *= 3. * cos(theta) - 1.;
-            result *= cos(theta / 2.);
-            break;
-        }
-        case -311:
-        {
-            result = -1. / 2.;
-            result *= 3. * cos(theta) + 1.;
-            result *= sin(theta / 2.);
-            break;
+            double c = double(2 * m + a + b);
+            double A = 2. * m * (m + a + b) * (c - 2.);
+            double B = (c - 1.) * double(a * a - b * b);
+            double C = (c - 1.) * c * (c - 2.);
+            double D = 2. * (m + a - 1.) * (m + b - 1.) * c;
+
+            T p2 = ((B + C * x) * p1 - D * p0) / A;
+            p0 = p1; p1 = p2;
         }
 
-        // Spin- 5/2
-        case  533:
-        {
-            result = -1. / 4.;
-            result *= cos(theta / 2.);
-            result *= (1. + cos(theta)) * (3. - 5. * cos(theta));
-            break;
-        }
-        case  531:
-        {
-            result = sqrt(2.) / 4.;
-            result *= sin(theta / 2.);
-            result *= (1. + cos(theta)) * (1. - 5. * cos(theta));
-            break;
-        }
-        case -531:
-        {
-            result =  sqrt(2.) / 4.;
-            result *= cos(theta / 2.);
-            result *= (1. - cos(theta)) * (1. + 5. * cos(theta));
-            break;
-        }
-        case -533:
-        {
-            result = -1. / 4.;
-            result *= sin(theta / 2.);
-            result *= (1. - cos(theta)) * (3. + 5. * cos(theta));
-            break;
-        }
-        case  511:
-        {
-            result = -1. / 2.;
-            result *= cos(theta / 2.);
-            result *= (1. + 2. * cos(theta) - 5. * cos(theta)*cos(theta));
-            break;
-        }
-        case -511:
-        {
-            result = 1. / 2.;
-            result *= sin(theta / 2.);
-            result *= (1. - 2. * cos(theta) - 5. * cos(theta)*cos(theta));
-            break;
-        }
+        return p1;
+    };
 
-        default: return 0.;
+    // x^(a/2) for integer a
+    inline double half_power(double x, int a)
+    {
+        double result = (a % 2 == 0) ? 1. : sqrt(x);
+        for (int i = 0; i < a / 2; i++) result *= x;
+        return result;
     };
 
-    return phase * result;
+    // Helicities need to be in range and have the same parity as j
+    inline bool valid_helicities(int j, int lam1, int lam2)
+    {
+        return (j >= 0) && (std::abs(lam1) <= j) && (std::abs(lam2) <= j)
+            && ((j - lam1) % 2 == 0) && ((j - lam2) % 2 == 0);
+    };
 };
 
 // ---------------------------------------------------------------------------
-double jpacPhoto::wigner_d_int(int j, int lam1, int lam2, double theta)
+// Single elements
+
+double jpacPhoto::wigner_d(int j, int lam1, int lam2, double theta)
 {
+    if (!valid_helicities(j, lam1, lam2)) return 0.;
 
-    double phase = 1.;
-    // If first lam argument is smaller, switch them
-    if (abs(lam1) < abs(lam2))
-    {
-        int temp = lam1;
-        lam1 = lam2;
-        lam2 = temp;
+    wigner_jacobi_params x = jacobi_params(j, lam1, lam2);
 
-        phase *= pow(-1., double(lam1 - lam2));
-    };
+    // cos(theta) from the half angles saves a third trig call
+    double sinhalf = sin(theta / 2.), coshalf = cos(theta / 2.);
+    double cosine  = (coshalf - sinhalf) * (coshalf + sinhalf);
 
-    // If first lam is negative, smitch them
-    if (lam1 < 0)
-    {
-        lam1 *= -1;
-        lam2 *= -1;
+    double result = x.norm;
+    for (int i = 0; i < x.a; i++) result *= sinhalf;
+    for (int i = 0; i < x.b; i++) result *= coshalf;
+    result *= jacobi(x.k, x.a, x.b, cosine);
+
+    return result;
+};
+
+std::complex<double> jpacPhoto::wigner_d_cos(int j, int lam1, int lam2, std::complex<double> cosine)
+{
+    if (!valid_helicities(j, lam1, lam2)) return 0.;
+
+    std::complex<double> sinhalf = sqrt((XR - cosine) / 2.);
+    std::complex<double> coshalf = sqrt((XR + cosine) / 2.);
+
+    wigner_jacobi_params x = jacobi_params(j, lam1, lam2);
+
+    std::complex<double> result = x.norm;
+    result *= pow(sinhalf, x.a) * pow(coshalf, x.b);
+    result *= jacobi(x.k, x.a, x.b, cosine);
+
+    return result;
+};
 
-        phase *= pow(-1., double(lam1 - lam2));
+// ---------------------------------------------------------------------------
+// Whole matrix
+
+jpacPhoto::wigner_d_matrix::wigner_d_matrix(int j)
+: _j(j), _n(j + 1), _d((j + 1) * (j + 1), 0.)
+{
+    if (j < 0)
+    {
+        std::cout << "\nwigner_d_matrix: Invalid spin j = " << j << "/2 passed as argument!\n";
+        _j = 0; _n = 1; _d.resize(1);
     }
+};
 
-    // Output
-    double result = 0.;
+void jpacPhoto::wigner_d_matrix::update(double theta)
+{
+    if (!_empty && theta == _cached_theta) return;
 
-    int id = ((lam2 >= 0) - (lam2 < 0)) * (j * 100 + lam1 * 10 + abs(lam2)); // negative sign refers to negative lam2
-    switch (id)
-    {   
-        // Spin 1
-        case  111:
-        {
-            result = (1. + cos(theta)) / 2.;
-            break;
-        }
-        case  110:
-        {
-            result = - sin(theta) / sqrt(2.);
-            break;
-        }
-        case -111:
-        {
-            result = (1. - cos(theta)) / 2.;
-            break;
-        }
-        case  100:
+    double sinhalf = sin(theta / 2.), coshalf = cos(theta / 2.), cosine = cos(theta);
+
+    // Powers of the half angles needed for all elements
+    std::vector<double> sin_pow(_n, 1.), cos_pow(_n, 1.);
+    for (int i = 1; i < _n; i++)
+    {
+        sin_pow[i] = sin_pow[i-1] * sinhalf;
+        cos_pow[i] = cos_pow[i-1] * coshalf;
+    }
+
+    for (int i = 0; i < _n; i++)
+    {
+        for (int k = 0; k < _n; k++)
         {
-            result = cos(theta);
-            break;
+            wigner_jacobi_params x = jacobi_params(_j, _j - 2 * i, _j - 2 * k);
+            _d[i * _n + k] = x.norm * sin_pow[x.a] * cos_pow[x.b] * jacobi(x.k, x.a, x.b, cosine);
         }
-
-        default: return 0.;
     }
 
-    return phase * result;
+    _cached_theta = theta;
+    _empty = false;
 };
 
-// ---------------------------------------------------------------------------
-std::complex<double> jpacPhoto::wigner_d_int_cos(int j, int lam1, int lam2, double cosine)
+void jpacPhoto::wigner_d_matrix::evaluate(const std::vector<double> & thetas, std::vector<double> & result) const
 {
-    // Careful because this loses the +- phase of the sintheta. 
-    std::complex<double> sine = sqrt(XR - cosine * cosine);
-
-    std::complex<double> sinhalf =  sqrt((XR - cosine) / 2.);
-    std::complex<double> coshalf =  sqrt((XR + cosine) / 2.);
+    int N = thetas.size();
+    result.resize(_n * _n * N);
 
-    double phase = 1.;
-    // If first lam argument is smaller, switch them
-    if (abs(lam1) < abs(lam2))
+    std::vector<double> sinhalf(N), coshalf(N), cosine(N);
+    for (int i = 0; i < N; i++)
     {
-        int temp = lam1;
-        lam1 = lam2;
-        lam2 = temp;
+        sinhalf[i] = sin(thetas[i] / 2.);
+        coshalf[i] = cos(thetas[i] / 2.);
+        cosine[i]  = cos(thetas[i]);
+    }
 
-        phase *= pow(-1., double(lam1 - lam2));
-    };
+    // Running P_{m-2}, P_{m-1} of the recurrence at every angle
+    std::vector<double> p0(N), p1(N);
 
-    // If first lam is negative, smitch them
-    if (lam1 < 0)
+    for (int i = 0; i < _n; i++)
     {
-        lam1 *= -1;
-        lam2 *= -1;
+        for (int k = 0; k < _n; k++)
+        {
+            wigner_jacobi_params x = jacobi_params(_j, _j - 2 * i, _j - 2 * k);
+            double * out = &result[(i * _n + k) * N];
+
+            for (int n = 0; n < N; n++)
+            {
+                p0[n] = 1.;
+                p1[n] = double(x.a - x.b) / 2. + double(x.a + x.b + 2) * cosine[n] / 2.;
+            }
+
+            for (int m = 2; m <= x.k; m++)
+            {
+                double c = double(2 * m + x.a + x.b);
+                double A = 2. * m * (m + x.a + x.b) * (c - 2.);
+                double B = (c - 1.) * double(x.a * x.a - x.b * x.b);
+                double C = (c - 1.) * c * (c - 2.);
+                double D = 2. * (m + x.a - 1.) * (m + x.b - 1.) * c;
+
+                for (int n = 0; n < N; n++)
+                {
+                    double p2 = ((B + C * cosine[n]) * p1[n] - D * p0[n]) / A;
+                    p0[n] = p1[n]; p1[n] = p2;
+                }
+            }
+
+            const std::vector<double> & P = (x.k == 0) ? p0 : p1;
+            for (int n = 0; n < N; n++)
+            {
+                out[n] = x.norm * pow(sinhalf[n], x.a) * pow(coshalf[n], x.b) * P[n];
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Interpolation tables
 
-        phase *= pow(-1., double(lam1 - lam2));
+jpacPhoto::wigner_d_table::wigner_d_table(int j, double tolerance, int budget)
+: _j(j), _n(j + 1)
+{
+    if (j < 0)
+    {
+        std::cout << "\nwigner_d_table: Invalid spin j = " << j << "/2 passed as argument!\n";
+        _j = 0; _n = 1;
     }
 
-    std::complex<double> result = 0.;
-    int id = ((lam2 >= 0) - (lam2 < 0)) * (j * 100 + lam1 * 10 + abs(lam2)); // negative sign refers to negative lam2
-    switch (id)
-    {   
-        // Spin 1
-        case  111:
+    _a.resize(_n * _n); _b.resize(_n * _n);
+    for (int i = 0; i < _n; i++)
+    {
+        for (int k = 0; k < _n; k++)
         {
-            result = (1. + cosine) / 2.;
-            break;
+            wigner_jacobi_params x = jacobi_params(_j, _j - 2 * i, _j - 2 * k);
+            _a[i * _n + k] = x.a;
+            _b[i * _n + k] = x.b;
         }
-        case  110:
+    }
+
+    // Start with 16 cells and halve the spacing until the tolerance is met
+    int bytes_per_node = 2 * _n * _n * sizeof(double);
+    int N = 17;
+    while (true)
+    {
+        fill(N);
+
+        // Check the midpoints of every cell against the exact d-function
+        _error = 0.;
+        for (int e = 0; e < _n * _n; e++)
         {
-            result = - sine / sqrt(2.);
-            break;
+            for (int i = 0; i < _N - 1; i++)
+            {
+                double z = -1. + (double(i) + 0.5) * _h;
+                double exact = wigner_d(_j, _j - 2 * (e / _n), _j - 2 * (e % _n), acos(z));
+                _error = std::max(_error, std::abs(half_angles(e, z) * interpolate(e, z) - exact));
+            }
         }
-        case -111:
+
+        if (_error < tolerance) break;
+
+        if ((2 * N - 1) * bytes_per_node > budget)
         {
-            result = (1. - cosine) / 2.;
+            std::cout << "\nwigner_d_table: Memory budget of " << budget << " bytes reached for j = " << _j << "/2. ";
+            std::cout << "Using " << _N << " points with max error " << _error << ".\n";
             break;
         }
-        case  100:
+
+        N = 2 * N - 1;
+    }
+};
+
+void jpacPhoto::wigner_d_table::fill(int N)
+{
+    _N = N;
+    _h = 2. / double(N - 1);
+    _table.resize(_n * _n * N * 2);
+
+    for (int e = 0; e < _n * _n; e++)
+    {
+        wigner_jacobi_params x = jacobi_params(_j, _j - 2 * (e / _n), _j - 2 * (e % _n));
+
+        for (int i = 0; i < N; i++)
         {
-            result = cosine;
-            break;
-        }
+            double z = -1. + double(i) * _h;
+
+            // d/dz P_k^(a,b)(z) = (k + a + b + 1)/2 P_{k-1}^(a+1,b+1)(z)
+            double derivative = 0.;
+            if (x.k > 0) derivative = double(x.k + x.a + x.b + 1) / 2. * jacobi(x.k - 1, x.a + 1, x.b + 1, z);
 
-        default: return 0.;
+            _table[(e * N + i) * 2]     = x.norm * jacobi(x.k, x.a, x.b, z);
+            _table[(e * N + i) * 2 + 1] = x.norm * derivative;
+        }
     }
+};
 
-    return phase * result;
-};
\ No newline at end of file
+double jpacPhoto::wigner_d_table::interpolate(int e, double z) const
+{
+    double x = (z + 1.) / _h;
+    int i = std::min(std::max(int(x), 0), _N - 2);
+    double u = x - double(i);
+
+    // Hermite basis polynomials
+    double u2 = u * u, u3 = u2 * u;
+    double h00 = 2. * u3 - 3. * u2 + 1.;
+    double h10 = u3 - 2. * u2 + u;
+    double h01 = 3. * u2 - 2. * u3;
+    double h11 = u3 - u2;
+
+    const double * p = &_table[(e * _N + i) * 2];
+    return h00 * p[0] + h10 * _h * p[1] + h01 * p[2] + h11 * _h * p[3];
+};
+
+double jpacPhoto::wigner_d_table::half_angles(int e, double z) const
+{
+    return half_power((1. - z) / 2., _a[e]) * half_power((1. + z) / 2., _b[e]);
+};
+
+double jpacPhoto::wigner_d_table::operator()(int lam1, int lam2, double z) const
+{
+    if (!valid_helicities(_j, lam1, lam2)) return 0.;
+
+    // Guard against rounding just outside the physical region
+    z = std::min(std::max(z, -1.), 1.);
+
+    int e = ((_j - lam1) / 2) * _n + (_j - lam2) / 2;
+    return half_angles(e, z) * interpolate(e, z);
+};